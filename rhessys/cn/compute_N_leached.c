@@ -30,6 +30,7 @@
 #include <stdio.h>
 #include <math.h>
 #include "rhessys.h"
+#include "fast_math.h"
 
 
 double	compute_N_leached(int verbose_flag, 
@@ -86,6 +87,7 @@ double	compute_N_leached(int verbose_flag,
 	double	available_water,septic_depth;
 
 	nleached = 0.0;
+	navail = 0.0;
 	Qtotal = 0.0;
 	nabsorbed=0.0;
 
@@ -104,32 +106,21 @@ double	compute_N_leached(int verbose_flag,
 	/*------------------------------------------------------*/
 	if ((s1 == 0.0) && (s2 == 0.0)) {
 		
-		z2 = -1.0 * p * log (1 - (Qout) / (p * n_0));
+		z2 = -1.0 * p * LOG(1 - (Qout) / (p * n_0));
 		z1 = 0.0;
 		if (N_decay_rate > ZERO) {	
 			navail = total_nitrate
-				/ (1.0 - exp(-1.0 * N_decay_rate * z2_N) )
-				* (exp(-1.0 * N_decay_rate * z1)
-				- exp(-1.0 * N_decay_rate * (z2)));
+				/ (1.0 - EXP(-1.0 * N_decay_rate * z2_N) )
+				* (EXP(-1.0 * N_decay_rate * z1)
+				- EXP(-1.0 * N_decay_rate * (z2)));
 		}
 		else {
 			navail = total_nitrate * (z2-z1)/z2_N;
 		}
-		nabsorbed=compute_N_absorbed(verbose_flag,
-						z1,
-						z2,
-						N_absorption_rate,
-						p,
-						n_0); 
 	/*------------------------------------------------------*/
 	/* in return flow Qout/theta = 1 so			*/
 	/*------------------------------------------------------*/
-		if (nabsorbed > navail) {
-			navail=0;
-			}
-		else 
-		  nleached = navail-nabsorbed;
-		if (nleached > navail) nleached=navail;	
+		available_water = Qout;
 	}
 	
 	else {
@@ -153,9 +144,9 @@ double	compute_N_leached(int verbose_flag,
 			0.0);
 	if (N_decay_rate > 0.0) {	
 		navail = total_nitrate
-			/ (1.0 - exp(-1.0 * N_decay_rate * z2_N) )
-			* (exp(-1.0 * N_decay_rate * z1)
-			- exp(-1.0 * N_decay_rate * (z2)));
+			/ (1.0 - EXP(-1.0 * N_decay_rate * z2_N) )
+			* (EXP(-1.0 * N_decay_rate * z1)
+			- EXP(-1.0 * N_decay_rate * (z2)));
 
 		}
 
@@ -0,0 +1,166 @@
+/*--------------------------------------------------------------*/
+/* 								*/
+/*		compute_farq_psn_batch				*/
+/*								*/
+/*	NAME							*/
+/*		compute_farq_psn_batch				*/
+/*								*/
+/*	SYNOPSIS						*/
+/*		int compute_farq_psn_batch(			*/
+/*			int	verbose_flag,			*/
+/*			int	num_psn,			*/
+/*			struct psnin_struct *in,		*/
+/*			struct psnout_struct *out)		*/
+/*								*/
+/*	returns:						*/
+/*		number of inputs with a negative root		*/
+/*								*/
+/*	OPTIONS							*/
+/*								*/
+/*	DESCRIPTION						*/
+/*								*/
+/*	compute_farq_psn for num_psn inputs at once.  The	*/
+/*	temperature corrections of Ko, Kc and Rubisco activity	*/
+/*	(three Q10 pow calls) depend only on in->t, which is	*/
+/*	the zone's tday for every caller, so they are kept	*/
+/*	from one call to the next and only recomputed when t	*/
+/*	changes, i.e. once per zone-day.  The loop over inputs	*/
+/*	is then the two quadratic solves.			*/
+/*								*/
+/*	Inputs with no leaf N or no light (lnc or irad <= 0)	*/
+/*	are not solved and return A = dC13 = 0, as the callers	*/
+/*	of compute_farq_psn do.  An input with a negative root	*/
+/*	also returns A = dC13 = 0 and is counted in the return	*/
+/*	value.							*/
+/*	Otherwise each out[i] is bitwise the same as		*/
+/*	compute_farq_psn(&in[i], &out[i], 0).			*/
+/*								*/
+/*	verbose_flag > 2 prints psnin and psnout for each input	*/
+/*								*/
+/*	PROGRAMMER NOTES					*/
+/*								*/
+/*	C3 is hardcoded as in compute_farq_psn.			*/
+/*								*/
+/*--------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include "rhessys.h"
+#include "phys_constants.h"
+
+int compute_farq_psn_batch(
+					int verbose_flag,
+					int num_psn,
+					struct psnin_struct *in,
+					struct psnout_struct *out)
+{
+	/*------------------------------------------------------*/
+	/*	Local Variable Definition. 							*/
+	/*------------------------------------------------------*/
+	int	i, num_failed;
+	double tk, g, O2, Ca, gamma, Rd, Vmax, Jmax, J, Av, Aj, A;
+	double aa, bb, cc, det_v, det_j;
+	static double ppe = 2.6;	/* (mol/mol) C3 photons per e- */
+	static double fnr = 7.16;	/* kg Rub/kg NRub */
+	static double Kc25 = 404.0;	/* (ubar) MM const carboxylase, 25 deg C */
+	static double q10Kc = 2.1;	/* (DIM) Q_10 for kc */
+	static double Ko25 = 248.0;	/* (mbar) MM const oxygenase, 25 deg C */
+	static double q10Ko = 1.2;	/* (DIM) Q_10 for ko */
+	static double act25 = 3.6;	/* (umol/mgRubisco/min) Rubisco activity */
+	static double q10act = 2.4;	/* (DIM) Q_10 for Rubisco activity */
+	static double pabs = 0.85;	/* (DIM) fPAR effectively absorbed by PSII */
+	/*------------------------------------------------------*/
+	/*	temperature corrected constants of the last t	*/
+	/*------------------------------------------------------*/
+	static int	have_t = 0;
+	static double	last_t, Ko, Kc, act;
+
+	num_failed = 0;
+	for (i=0; i < num_psn; i++) {
+		in[i].c3 = 1;
+		if ((in[i].lnc <= 0.0) || (in[i].irad <= 0.0)) {
+			out[i].A = 0.0;
+			out[i].dC13 = 0.0;
+			continue;
+		}
+		/*--------------------------------------------------------------*/
+		/*	Q10 corrections, only when t changes			*/
+		/*--------------------------------------------------------------*/
+		if (!have_t || (in[i].t != last_t)) {
+			last_t = in[i].t;
+			have_t = 1;
+			Ko = Ko25 * pow(q10Ko, (last_t-25.0)/10.0);
+			Ko = Ko * 100.0;
+			if (last_t > 15.0){
+				Kc = Kc25 * pow(q10Kc, (last_t-25.0)/10.0);
+				act = act25 * pow(q10act, (last_t-25.0)/10.0);
+			}
+			else{
+				Kc = Kc25 * pow(1.8*q10Kc, (last_t-15.0)/10.0) / q10Kc;
+				act = act25 * pow(1.8*q10act, (last_t-15.0)/10.0) / q10act;
+			}
+			Kc = Kc * 0.10;
+			act = act * 1e6 / 60.0;
+		}
+		Rd = in[i].Rd;
+		tk = in[i].t + 273.15;
+		g = in[i].g * 1e3 / (R * tk);
+		Ca = in[i].co2 * in[i].pa / 1e6;
+		O2 = 0.21 * in[i].pa;
+		gamma = 0.5 * 0.21 * Kc * O2 / Ko;
+		Vmax = in[i].lnc * in[i].flnr * fnr * act;
+		Jmax = 2.1 * Vmax;
+		aa = 0.7;
+		bb = -Jmax - (in[i].irad*pabs/ppe);
+		cc = Jmax * in[i].irad*pabs/ppe;
+		J = (-bb - sqrt(bb*bb - 4.0*aa*cc))/(2.0*aa);
+		/*--------------------------------------------------------------*/
+		/*	quadratic solutions for Av and Aj			*/
+		/*--------------------------------------------------------------*/
+		aa = -1.0/g;
+		bb = Ca + (Vmax - Rd)/g + Kc*(1.0 + O2/Ko);
+		cc = Vmax*(gamma - Ca) + Rd*(Ca + Kc*(1.0 + O2/Ko));
+		det_v = bb*bb - 4.0*aa*cc;
+		Av = (-bb + sqrt(max(det_v, 0.0))) / (2.0*aa);
+		aa = -4.5/g;
+		bb = 4.5*Ca + 10.5*gamma + J/g - 4.5*Rd/g;
+		cc = J*(gamma - Ca) + Rd*(4.5*Ca + 10.5*gamma);
+		det_j = bb*bb - 4.0*aa*cc;
+		Aj = (-bb + sqrt(max(det_j, 0.0))) / (2.0*aa);
+		if ((det_v < 0.0) || (det_j < 0.0)) {
+			printf("negative root error in psn routine\n");
+			out[i].A = 0.0;
+			out[i].dC13 = 0.0;
+			num_failed++;
+			continue;
+		}
+		A = (Av < Aj) ? Av : Aj;
+
+		out[i].A = A;
+		out[i].g = g;
+		out[i].Ca = Ca;
+		out[i].Ci = Ca - A/g;
+		out[i].dC13 = out[i].Ci/out[i].Ca*(28-4.4)+4.4;
+		out[i].gamma = gamma;
+		out[i].O2 = O2;
+		out[i].Kc = Kc;
+		out[i].Ko = Ko;
+		out[i].act = act;
+		out[i].Vmax = Vmax;
+		out[i].Jmax = Jmax;
+		out[i].J = J;
+		out[i].Av = Av;
+		out[i].Aj = Aj;
+		if (verbose_flag > 2) {
+			printf("psnin: %lf %lf %lf %lf %lf %lf %lf %lf %d %lf\n",
+				in[i].pa, in[i].co2, in[i].t, in[i].irad,
+				g, in[i].Rd, in[i].lnc, in[i].flnr,
+				in[i].c3, ppe);
+			printf("psnout: %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf %lf\n",
+				g, O2, Ca, out[i].Ci, gamma, Kc, Ko, act,
+				Vmax, Jmax, J, Av, Aj, A);
+		}
+	}
+	return(num_failed);
+}	 /* end compute_farq_psn_batch.c */
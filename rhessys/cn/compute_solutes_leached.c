@@ -0,0 +1,190 @@
+/*--------------------------------------------------------------*/
+/*                                                              */
+/*		compute_solutes_leached				*/
+/*                                                              */
+/*  NAME                                                        */
+/*		compute_solutes_leached				*/
+/*                                                              */
+/*                                                              */
+/*  SYNOPSIS                                                    */
+/*  void compute_solutes_leached(int				*/
+/*					struct soil_default *,	*/
+/*					double	*,		*/
+/*					double	,		*/
+/*					double	,		*/
+/*					double	,		*/
+/*					double	*);		*/
+/*                                                              */
+/*  OPTIONS                                                     */
+/*	verbose_flag						*/
+/*	defaults - soil default of the patch			*/
+/*	total - (kg/m2) soil nitrate, sminn, DON and DOC	*/
+/*		indexed by LEACH_NO3, LEACH_NH4, LEACH_DON and	*/
+/*		LEACH_DOC					*/
+/*	Qout - (m) water leaving the patch			*/
+/*	s1, s2 - (m) sat_deficit at the top and bottom of the	*/
+/*		layer the water leaves from			*/
+/*	leached - (kg/m2) returns the flux of each solute	*/
+/*                                                              */
+/*  DESCRIPTION                                                 */
+/*                                                              */
+/*  compute_N_leached for all four leached solutes at once.	*/
+/*  The depths z1 and z2 of the layer, the water it holds and	*/
+/*  the soil it adsorbs to depend only on the water flux and	*/
+/*  the soil, so they are computed once; each solute then	*/
+/*  differs only in its pool, decay rate (N_decay_rate for	*/
+/*  nitrate and sminn, DOM_decay_rate for DON and DOC) and	*/
+/*  adsorption rate, held by LEACH_* in the soil default.	*/
+/*  Gives the same fluxes as four calls of compute_N_leached.	*/
+/*								*/
+/*  Return flow (s1 = s2 = 0) is left to compute_N_leached,	*/
+/*  called once per solute: that case reads available_water	*/
+/*  before setting it, so it has no defined flux to fuse.	*/
+/*								*/
+/*  PROGRAMMER NOTES                                            */
+/*                                                              */
+/*  The exponentials of a decay rate are reused for the next	*/
+/*  solute when it has the same rate.  The per-solute loops	*/
+/*  keep the arithmetic of compute_N_leached term for term so	*/
+/*  the results are bitwise the same.				*/
+/*                                                              */
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <math.h>
+#include "rhessys.h"
+#include "fast_math.h"
+#include "phys_constants.h"
+
+void	compute_solutes_leached(int verbose_flag,
+			struct soil_default *defaults,
+			double *total,
+			double Qout,
+			double s1,
+			double s2,
+			double *leached)
+	{
+	/*------------------------------------------------------*/
+	/*	Local Function Declarations.						*/
+	/*------------------------------------------------------*/
+	double  compute_delta_water(
+		int,
+		double,
+		double,
+		double,
+		double,
+		double);
+	double  compute_z_final(
+		int,
+		double,
+		double,
+		double,
+		double,
+		double);
+	double	compute_N_leached(int,
+		double,
+		double,
+		double,
+		double,
+		double,
+		double,
+		double,
+		double,
+		double,
+		double,
+		double,
+		double,
+		double *);
+
+	/*------------------------------------------------------*/
+	/*	Local Variable Definition. 							*/
+	/*------------------------------------------------------*/
+	int	i;
+	double	n_0, p, z2_N, z1, z2;
+	double	available_water, pore_depth, bulk_density;
+	double	decay, nabsorbed;
+	double	depth_decay[NUM_LEACH_SOLUTES];
+	double	layer_decay[NUM_LEACH_SOLUTES];
+	double	navail[NUM_LEACH_SOLUTES];
+
+	for (i=0; i < NUM_LEACH_SOLUTES; i++)
+		leached[i] = 0.0;
+	/*------------------------------------------------------*/
+	/* export only occurs when Qout > 0.0			*/
+	/*------------------------------------------------------*/
+	if (Qout <= ZERO)
+		return;
+	n_0 = defaults[0].porosity_0;
+	p = defaults[0].porosity_decay;
+	z2_N = defaults[0].active_zone_z;
+	if (s1 < 0.0) s1 = 0.0;
+	if (s2 < s1) s2 = s1;
+	/*------------------------------------------------------*/
+	/*	return flow, one solute at a time		*/
+	/*------------------------------------------------------*/
+	if ((s1 == 0.0) && (s2 == 0.0)) {
+		for (i=0; i < NUM_LEACH_SOLUTES; i++)
+			leached[i] = compute_N_leached(verbose_flag, total[i],
+				Qout, s1, s2, 0.0, 0.0, n_0, p,
+				defaults[0].leach_decay_rate[i], z2_N,
+				defaults[0].soil_depth,
+				defaults[0].leach_adsorption_rate[i], NULL);
+		return;
+	}
+	/*------------------------------------------------------*/
+	/*	shared water profile of subsurface flow		*/
+	/*	through the saturated zone			*/
+	/*------------------------------------------------------*/
+	z2 = compute_z_final(verbose_flag, n_0, p,
+		defaults[0].soil_depth, s2, 0.0);
+	z1 = compute_z_final(verbose_flag, n_0, p,
+		defaults[0].soil_depth, s1, 0.0);
+	available_water = compute_delta_water(verbose_flag, n_0, p,
+		defaults[0].soil_depth, z2, z1);
+	bulk_density = PARTICLE_DENSITY * (1.0 - n_0) * 1000;
+	pore_depth = n_0*(z2-z1);
+	/*------------------------------------------------------*/
+	/*	decay of each solute with depth			*/
+	/*------------------------------------------------------*/
+	for (i=0; i < NUM_LEACH_SOLUTES; i++) {
+		decay = defaults[0].leach_decay_rate[i];
+		if ( (i > 0) && (decay == defaults[0].leach_decay_rate[i-1]) ) {
+			depth_decay[i] = depth_decay[i-1];
+			layer_decay[i] = layer_decay[i-1];
+		}
+		else {
+			depth_decay[i] = 1.0 - EXP(-1.0 * decay * z2_N);
+			layer_decay[i] = EXP(-1.0 * decay * z1)
+				- EXP(-1.0 * decay * (z2));
+		}
+	}
+	/*------------------------------------------------------*/
+	/*	available solute in the layer			*/
+	/*------------------------------------------------------*/
+	for (i=0; i < NUM_LEACH_SOLUTES; i++) {
+		decay = defaults[0].leach_decay_rate[i];
+		if (decay > 0.0)
+			navail[i] = total[i] / depth_decay[i] * layer_decay[i];
+		else if (z1 > -1.0*decay)
+			navail[i] = 0.0;
+		else
+			navail[i] = total[i] * (z2-z1)/(z2_N + decay);
+	}
+	/*------------------------------------------------------*/
+	/* less adsorbed solute, as a mass flux		*/
+	/* i.e n_avail / theta * outflow			*/
+	/*------------------------------------------------------*/
+	for (i=0; i < NUM_LEACH_SOLUTES; i++) {
+		nabsorbed = pore_depth * defaults[0].leach_adsorption_rate[i]
+			* bulk_density;
+		nabsorbed = max(nabsorbed, 0.0);
+		if (nabsorbed > navail[i])
+			navail[i] = 0.0;
+		else
+			navail[i] = navail[i] - nabsorbed;
+		if (available_water > ZERO)
+			leached[i] = navail[i] * Qout / available_water;
+		if (leached[i] > navail[i]) leached[i] = navail[i];
+		leached[i] = max(leached[i], 0.0);
+	}
+	return;
+} /* end compute_solutes_leached */
@@ -55,6 +55,8 @@ void	basin_daily_F(
 	/*--------------------------------------------------------------*/
 	/*  Local Function Declarations.                                */
 	/*--------------------------------------------------------------*/
+	void	profile_start( struct profile_object *, int );
+	void	profile_stop( struct profile_object *, int );
 	void hillslope_daily_F(
 		long,
 		struct	world_object *,
@@ -68,6 +70,10 @@ void	basin_daily_F(
 		struct command_line_object *,
 		struct basin_object *,
 		int, struct	date);
+
+	int	compute_routing_timesteps(
+		struct command_line_object *,
+		struct basin_object *);
 	
 	double	compute_stream_routing(
 		struct command_line_object *,
@@ -77,6 +83,7 @@ void	basin_daily_F(
 	/*  Local variable definition.                                  */
 	/*--------------------------------------------------------------*/
 	int	h, z, p;
+	int	n_timesteps;
 	double	scale;
 	struct	hillslope_object *hillslope;
 	struct	patch_object *patch; 
@@ -99,10 +106,19 @@ void	basin_daily_F(
 	/*      the basin                                               */
 	/*--------------------------------------------------------------*/
     if ( command_line[0].routing_flag == 1) {
+		profile_start(command_line[0].profile, PROFILE_SUBSURFACE_ROUTING);
+		/*--------------------------------------------------------------*/
+		/*	-adaptroute picks the day's steps from the fluxes		*/
+		/*--------------------------------------------------------------*/
+		if (command_line[0].adaptive_routing_flag == 1)
+			n_timesteps = compute_routing_timesteps(command_line, basin);
+		else
+			n_timesteps = basin[0].defaults[0][0].n_routing_timesteps;
 		compute_subsurface_routing(command_line,
 			basin,
-			basin[0].defaults[0][0].n_routing_timesteps,
+			n_timesteps,
 			current_date);
+		profile_stop(command_line[0].profile, PROFILE_SUBSURFACE_ROUTING);
 	}
 
 	/*--------------------------------------------------------------*/
@@ -110,10 +126,12 @@ void	basin_daily_F(
 	/*      the basin                                               */
 	/*--------------------------------------------------------------*/
     	if ( command_line[0].stream_routing_flag == 1) {
+		profile_start(command_line[0].profile, PROFILE_STREAM_ROUTING);
 		 basin[0].stream_list.streamflow=compute_stream_routing(command_line,
 			basin[0].stream_list.stream_network,
 			basin[0].stream_list.num_reaches,
                         current_date);
+		profile_stop(command_line[0].profile, PROFILE_STREAM_ROUTING);
 	}
 
 
@@ -70,10 +70,6 @@ void		basin_daily_I(
 	/*--------------------------------------------------------------*/
 	/*  Local variable definition.                                  */
 	/*--------------------------------------------------------------*/
-	double	cosegeom;
-	double	sinegeom;
-	double	coshss;
-	double	hss;
 	int	hillslope;
 	/*--------------------------------------------------------------*/
 	/*	Daylength (seconds)											*/
@@ -84,19 +80,12 @@ void		basin_daily_I(
 	/*	Note that we may want to consider daylengths with both		*/
 	/*		diffuse and direct irradiance and only diffuse irradianc*/
 	/*		This can be computed using the zone level horizons.		*/
-	/*--------------------------------------------------------------*/
-	cosegeom = cos(basin[0].latitude*DtoR) * world[0].cos_declin;
-	sinegeom = sin(basin[0].latitude*DtoR) * world[0].sin_declin;
-	coshss = -(sinegeom) / cosegeom;
-	if (coshss < -1.0) coshss = -1.0; /* 24-hr daylight */
-	if (coshss > 1.0) coshss = 1.0;   /* 0-hr daylight */
-	hss = acos(coshss);  /* hour angle at sunset (radians) */
-	basin[0].daylength= 2.0 * hss * SECPERRAD;
-	/*--------------------------------------------------------------*/
-	/*	Find solar zenith angle at noon (not elevation angle)	*/
+	/*	Solar zenith angle at noon (not elevation angle)	*/
 	/*	Form Linacre.						*/
+	/*	Both are tabulated by construct_solar_ephemeris.	*/
 	/*--------------------------------------------------------------*/
-	basin[0].theta_noon =  basin[0].latitude*DtoR - world[0].declin;
+	basin[0].daylength = basin[0].ephemeris[world[0].declin_index].daylength;
+	basin[0].theta_noon = basin[0].ephemeris[world[0].declin_index].theta_noon;
 	/*--------------------------------------------------------------*/
 	/*	Simulate the hillslopes in this basin for the whole day		*/
 	/*--------------------------------------------------------------*/
@@ -165,20 +165,23 @@ void	canopy_stratum_daily_F(
 		double	,
 		double	);
 	
-	double	penman_monteith(
+	void	penman_monteith_batch(
 		int	,
 		double	,
 		double	,
-		double	,
-		double	,
-		double	,
-		double	,
-		int	);
+		int	,
+		double	*,
+		double	*,
+		double	*,
+		double	*,
+		int	,
+		double	*);
 	
-	int	compute_farq_psn(
+	int	compute_farq_psn_batch(
+		int ,
+		int ,
 		struct psnin_struct * ,
-		struct psnout_struct * ,
-		int);
+		struct psnout_struct * );
 	
 	double	compute_potential_N_uptake_Dickenson(
 		struct	epconst_struct,
@@ -234,6 +237,8 @@ void	canopy_stratum_daily_F(
 	double	rainy_evaporation;
 	double	rain_throughfall;
 	double	rnet_evap;
+	int	num_pm, pm_sunlit, pm_shade;
+	double	pm_vpd[6], pm_rnet[6], pm_rs[6], pm_ra[6], pm_et[6];
 	double	rnet_trans, rnet_trans_sunlit, rnet_trans_shade;
 	double	snow_throughfall;
 	double	transpiration;
@@ -261,8 +266,8 @@ void	canopy_stratum_daily_F(
 	double m_vpd_shade;
 
 
-	struct	psnin_struct	psnin;
-	struct	psnout_struct	psnout;
+	struct	psnin_struct	psnin[2];
+	struct	psnout_struct	psnout[2];
 	struct mortality_struct mort;
 
 
@@ -857,27 +862,94 @@ void	canopy_stratum_daily_F(
 		rnet_evap = 0.0;
 
 	/*--------------------------------------------------------------*/
-	/*	Estimate potential evap rates.				*/
+	/*	Transpiration rate.					*/
+	/*--------------------------------------------------------------*/
+	/*--------------------------------------------------------------*/
+	/*	Reduce rnet for transpiration by ratio of lai to pai	*/
 	/*--------------------------------------------------------------*/
+
+	if (zone[0].metv.dayl > ZERO) {
+	rnet_trans_sunlit = 1000 * ((stratum[0].Kstar_direct + (perc_sunlit)*stratum[0].Kstar_diffuse)
+		* ( stratum[0].epv.proj_lai / stratum[0].epv.proj_pai ) + 
+		perc_sunlit* (stratum[0].Lstar + stratum[0].surface_heat_flux) ) / zone[0].metv.dayl;
+
+	rnet_trans_shade = 1000 * (( (1.0-perc_sunlit)*stratum[0].Kstar_diffuse)
+		* ( stratum[0].epv.proj_lai / stratum[0].epv.proj_pai ) + 
+		(1.0-perc_sunlit) * (stratum[0].Lstar + stratum[0].surface_heat_flux) ) / zone[0].metv.dayl;
+	}
+	else {
+		rnet_trans_sunlit = 0.0;
+		rnet_trans_shade = 0.0;
+		}
+			
+	rnet_trans_shade = max(rnet_trans_shade, 0.0);
+	rnet_trans_sunlit = max(rnet_trans_sunlit, 0.0);
+
+	/*--------------------------------------------------------------*/
+	/*	Potential evap and transpiration rates share the zone	*/
+	/*	air, so the penman_monteith calls are made as one batch	*/
+	/*--------------------------------------------------------------*/
+	num_pm = 0;
 	if ((stratum[0].gsurf > ZERO) && (stratum[0].ga > ZERO) && (rnet_evap > ZERO)) {
-	potential_evaporation_rate = penman_monteith(
-		command_line[0].verbose_flag,
-		zone[0].metv.tday,
-		zone[0].metv.pa,
-		zone[0].metv.vpd,
-		rnet_evap,
-		1/stratum[0].gsurf,
-		1/stratum[0].ga,
-		2) ;
-	potential_rainy_evaporation_rate = penman_monteith(
+		pm_vpd[num_pm] = zone[0].metv.vpd;
+		pm_rnet[num_pm] = rnet_evap;
+		pm_rs[num_pm] = 1/stratum[0].gsurf;
+		pm_ra[num_pm] = 1/stratum[0].ga;
+		num_pm++;
+		pm_vpd[num_pm] = 0;
+		pm_rnet[num_pm] = rnet_evap;
+		pm_rs[num_pm] = 1/stratum[0].gsurf;
+		pm_ra[num_pm] = 1/stratum[0].ga;
+		num_pm++;
+	}
+	pm_sunlit = num_pm;
+	if ( (rnet_trans_sunlit > ZERO ) &&
+		(stratum[0].defaults[0][0].lai_stomatal_fraction > ZERO ) &&
+		(stratum[0].gs_sunlit > ZERO) && ( stratum[0].ga > ZERO) ){
+		pm_vpd[num_pm] = zone[0].metv.vpd;
+		pm_rnet[num_pm] = rnet_trans_sunlit;
+		pm_rs[num_pm] = 1/stratum[0].gs_sunlit;
+		pm_ra[num_pm] = 1/stratum[0].ga;
+		num_pm++;
+		pm_vpd[num_pm] = zone[0].metv.vpd;
+		pm_rnet[num_pm] = rnet_trans_sunlit;
+		pm_rs[num_pm] = 1/stratum[0].potential_gs_sunlit;
+		pm_ra[num_pm] = 1/stratum[0].ga;
+		num_pm++;
+	}
+	pm_shade = num_pm;
+	if ( (rnet_trans_shade > ZERO ) &&
+		(stratum[0].defaults[0][0].lai_stomatal_fraction > ZERO ) &&
+		(stratum[0].gs_shade > ZERO) && ( stratum[0].ga > ZERO) ){
+		pm_vpd[num_pm] = zone[0].metv.vpd;
+		pm_rnet[num_pm] = rnet_trans_shade;
+		pm_rs[num_pm] = 1/stratum[0].gs_shade;
+		pm_ra[num_pm] = 1/stratum[0].ga;
+		num_pm++;
+		pm_vpd[num_pm] = zone[0].metv.vpd;
+		pm_rnet[num_pm] = rnet_trans_shade;
+		pm_rs[num_pm] = 1/stratum[0].potential_gs_shade;
+		pm_ra[num_pm] = 1/stratum[0].ga;
+		num_pm++;
+	}
+	penman_monteith_batch(
 		command_line[0].verbose_flag,
 		zone[0].metv.tday,
 		zone[0].metv.pa,
-		0,
-		rnet_evap,
-		1/stratum[0].gsurf,
-		1/stratum[0].ga,
-		2) ;
+		num_pm,
+		pm_vpd,
+		pm_rnet,
+		pm_rs,
+		pm_ra,
+		2,
+		pm_et);
+
+	/*--------------------------------------------------------------*/
+	/*	Estimate potential evap rates.				*/
+	/*--------------------------------------------------------------*/
+	if (pm_sunlit > 0) {
+		potential_evaporation_rate = pm_et[0];
+		potential_rainy_evaporation_rate = pm_et[1];
 	}
 	else {
 		potential_evaporation_rate = 0.0;
@@ -901,74 +973,17 @@ void	canopy_stratum_daily_F(
 	/*--------------------------------------------------------------*/
 	/*	Transpiration rate.					*/
 	/*--------------------------------------------------------------*/
-	/*--------------------------------------------------------------*/
-	/*	Reduce rnet for transpiration by ratio of lai to pai	*/
-	/*--------------------------------------------------------------*/
-
-	if (zone[0].metv.dayl > ZERO) {
-	rnet_trans_sunlit = 1000 * ((stratum[0].Kstar_direct + (perc_sunlit)*stratum[0].Kstar_diffuse)
-		* ( stratum[0].epv.proj_lai / stratum[0].epv.proj_pai ) + 
-		perc_sunlit* (stratum[0].Lstar + stratum[0].surface_heat_flux) ) / zone[0].metv.dayl;
-
-	rnet_trans_shade = 1000 * (( (1.0-perc_sunlit)*stratum[0].Kstar_diffuse)
-		* ( stratum[0].epv.proj_lai / stratum[0].epv.proj_pai ) + 
-		(1.0-perc_sunlit) * (stratum[0].Lstar + stratum[0].surface_heat_flux) ) / zone[0].metv.dayl;
+	if (pm_shade > pm_sunlit) {
+		transpiration_rate_sunlit = pm_et[pm_sunlit];
+		potential_transpiration_rate_sunlit = pm_et[pm_sunlit+1];
 	}
-	else {
-		rnet_trans_sunlit = 0.0;
-		rnet_trans_shade = 0.0;
-		}
-			
-	rnet_trans_shade = max(rnet_trans_shade, 0.0);
-	rnet_trans_sunlit = max(rnet_trans_sunlit, 0.0);
-
-	if ( (rnet_trans_sunlit > ZERO ) &&
-		(stratum[0].defaults[0][0].lai_stomatal_fraction > ZERO ) &&
-		(stratum[0].gs_sunlit > ZERO) && ( stratum[0].ga > ZERO) ){
-		transpiration_rate_sunlit = penman_monteith(
-			command_line[0].verbose_flag,
-			zone[0].metv.tday,
-			zone[0].metv.pa,
-			zone[0].metv.vpd,
-			rnet_trans_sunlit,
-			1/stratum[0].gs_sunlit,
-			1/stratum[0].ga,
-			2) ;
-		potential_transpiration_rate_sunlit = penman_monteith(
-			command_line[0].verbose_flag,
-			zone[0].metv.tday,
-			zone[0].metv.pa,
-			zone[0].metv.vpd,
-			rnet_trans_sunlit,
-			1/stratum[0].potential_gs_sunlit,
-			1/stratum[0].ga,
-			2) ;
-		}	
 	else{
 		transpiration_rate_sunlit = 0.0;
 		potential_transpiration_rate_sunlit = 0.0;
 	}
-	if ( (rnet_trans_shade > ZERO ) &&
-		(stratum[0].defaults[0][0].lai_stomatal_fraction > ZERO ) &&
-		(stratum[0].gs_shade > ZERO) && ( stratum[0].ga > ZERO) ){
-		transpiration_rate_shade = penman_monteith(
-			command_line[0].verbose_flag,
-			zone[0].metv.tday,
-			zone[0].metv.pa,
-			zone[0].metv.vpd,
-			rnet_trans_shade,
-			1/stratum[0].gs_shade,
-			1/stratum[0].ga,
-			2) ;
-		potential_transpiration_rate_shade = penman_monteith(
-			command_line[0].verbose_flag,
-			zone[0].metv.tday,
-			zone[0].metv.pa,
-			zone[0].metv.vpd,
-			rnet_trans_shade,
-			1/stratum[0].potential_gs_shade,
-			1/stratum[0].ga,
-			2) ;
+	if (num_pm > pm_shade) {
+		transpiration_rate_shade = pm_et[pm_shade];
+		potential_transpiration_rate_shade = pm_et[pm_shade+1];
 	}
 	else{
 		transpiration_rate_shade = 0.0;
@@ -1167,64 +1182,51 @@ void	canopy_stratum_daily_F(
 			/* note that at present potential only takes into account	*/
 			/*	water (i.e not nitrogen) limitations			*/
 			/*--------------------------------------------------------------*/
-			/* potential sunlit psn						*/
+			/* potential sunlit and shade psn				*/
+			/*	both use the maximum conductance; they are solved	*/
+			/*	as one batch						*/
 			/*--------------------------------------------------------------*/
 			if (stratum[0].defaults[0][0].epc.veg_type == C4GRASS)
-				psnin.c3 = 0;
+				psnin[0].c3 = 0;
 			else 
-				psnin.c3 = 1;
+				psnin[0].c3 = 1;
 			if (zone[0].metv.dayl > ZERO)
-				psnin.Rd = stratum[0].cdf.leaf_day_mr /
+				psnin[0].Rd = stratum[0].cdf.leaf_day_mr /
 				(stratum[0].epv.proj_lai 
 				* zone[0].metv.dayl*12.011e-9);
 			else
-				psnin.Rd = 0.0;
+				psnin[0].Rd = 0.0;
 
-			psnin.pa = zone[0].metv.pa;
-			psnin.co2 = zone[0].CO2;
-			psnin.flnr = stratum[0].defaults[0][0].epc.flnr;
-			psnin.t = zone[0].metv.tday;
-			psnin.irad = stratum[0].ppfd_sunlit;
-			if ((stratum[0].cs.leafc > ZERO) && (stratum[0].epv.proj_sla_sunlit > ZERO))
-				psnin.lnc = stratum[0].ns.leafn / (stratum[0].cs.leafc * 1.0)
-					/ stratum[0].epv.proj_sla_sunlit;
-			else
-				psnin.lnc = 0.0;
+			psnin[0].pa = zone[0].metv.pa;
+			psnin[0].co2 = zone[0].CO2;
+			psnin[0].flnr = stratum[0].defaults[0][0].epc.flnr;
+			psnin[0].t = zone[0].metv.tday;
 			/*--------------------------------------------------------------*/
 			/* note multiply by 1000; accounted for in compute_farq_psn by a /1000 */
 			/*	this is done for numerical precision			*/
 			/*--------------------------------------------------------------*/
-			psnin.g = max(stratum[0].defaults[0][0].epc.gl_smax ,
+			psnin[0].g = max(stratum[0].defaults[0][0].epc.gl_smax ,
 				stratum[0].defaults[0][0].epc.gl_c ) *
 				stratum[0].defaults[0][0].lai_stomatal_fraction * 1000 / 1.6;
-			if ((psnin.lnc > 0.0) && (psnin.irad > 0.0))
-				compute_farq_psn(&psnin, &psnout, 1);
-			else
-				psnout.A = 0.0;
-			assim_sunlit = psnout.A;
+			psnin[1] = psnin[0];
 
-			/*--------------------------------------------------------------*/
-			/* potential shade psn						*/
-			/*--------------------------------------------------------------*/
-			if (zone[0].metv.dayl > ZERO)
-				psnin.Rd = stratum[0].cdf.leaf_day_mr  /
-				(stratum[0].epv.proj_lai 
-				* zone[0].metv.dayl*12.011e-9);
+			psnin[0].irad = stratum[0].ppfd_sunlit;
+			if ((stratum[0].cs.leafc > ZERO) && (stratum[0].epv.proj_sla_sunlit > ZERO))
+				psnin[0].lnc = stratum[0].ns.leafn / (stratum[0].cs.leafc * 1.0)
+					/ stratum[0].epv.proj_sla_sunlit;
 			else
-				psnin.Rd = 0.0;
-
-			psnin.irad = stratum[0].ppfd_shade;
+				psnin[0].lnc = 0.0;
+			psnin[1].irad = stratum[0].ppfd_shade;
 			if ((stratum[0].cs.leafc > ZERO) && (stratum[0].epv.proj_sla_shade > ZERO))
-				psnin.lnc = stratum[0].ns.leafn / (stratum[0].cs.leafc * 1.0)
+				psnin[1].lnc = stratum[0].ns.leafn / (stratum[0].cs.leafc * 1.0)
 					/ stratum[0].epv.proj_sla_shade ;
 			else
-				psnin.lnc = 0.0;
+				psnin[1].lnc = 0.0;
 
-			if ((psnin.lnc > 0.0) && (psnin.irad > 0.0))
-				compute_farq_psn(&psnin, &psnout, 1);
-			else
-				psnout.A = 0.0;
-			assim_shade = psnout.A;
+			compute_farq_psn_batch(command_line[0].verbose_flag, 2,
+				psnin, psnout);
+			assim_sunlit = psnout[0].A;
+			assim_shade = psnout[1].A;
 
 			/*--------------------------------------------------------------*/
 			/* total potential psn						*/
@@ -1237,80 +1239,41 @@ void	canopy_stratum_daily_F(
 					*zone[0].metv.dayl*12.011e-9 + stratum[0].cdf.leaf_day_mr;
 			
 			/*--------------------------------------------------------------*/
-			/* actual sunlit psn						*/
+			/* actual sunlit and shade psn					*/
 			/*--------------------------------------------------------------*/
 			/*--------------------------------------------------------------*/
 			/*	convert water vapour to co2 conductance.		*/
-			/*--------------------------------------------------------------*/
-			if (zone[0].metv.dayl > ZERO)
-				psnin.Rd = stratum[0].cdf.leaf_day_mr /
-				(stratum[0].epv.proj_lai 
-				* zone[0].metv.dayl*12.011e-9);
-			else
-				psnin.Rd = 0.0;
-			/*--------------------------------------------------------------*/
 			/* note multiply by 1000; accounted for in compute_farq_psn by a /1000 */
 			/*	this is done for numerical precision			*/
 			/*--------------------------------------------------------------*/
 			if (stratum[0].epv.proj_lai_sunlit > ZERO)
-				psnin.g = stratum[0].gs_sunlit * 1000 / 1.6 / stratum[0].epv.proj_lai_sunlit;
+				psnin[0].g = stratum[0].gs_sunlit * 1000 / 1.6 / stratum[0].epv.proj_lai_sunlit;
 			else
-				psnin.g = 0.0;
-			psnin.irad = stratum[0].ppfd_sunlit;
+				psnin[0].g = 0.0;
 			if ((stratum[0].cs.leafc > ZERO) && (stratum[0].epv.proj_lai_sunlit > ZERO))
-				psnin.lnc = stratum[0].ns.leafn / (stratum[0].cs.leafc * 1.0)
+				psnin[0].lnc = stratum[0].ns.leafn / (stratum[0].cs.leafc * 1.0)
 					/ stratum[0].epv.proj_sla_sunlit;
 			else
-				psnin.lnc = 0.0;
-			if ((psnin.lnc > 0.0) && (psnin.irad > 0.0)) {
-				if ( compute_farq_psn(&psnin, &psnout, 1)){
-					fprintf(stderr,
-						"FATAL ERROR: in canopy_stratum_daily_F error in farquhar");
-					exit(EXIT_FAILURE);
-				}
-			}
-			else
-				psnout.A = 0.0;
-			assim_sunlit = psnout.A;
-			dC13_sunlit = psnout.dC13;
-
-			/*--------------------------------------------------------------*/
-			/* actual shade psn						*/
-			/*--------------------------------------------------------------*/
-			/*--------------------------------------------------------------*/
-			/*	convert water vapour to co2 conductance.		*/
-			/*--------------------------------------------------------------*/
-			if (zone[0].metv.dayl > ZERO)
-			psnin.Rd = stratum[0].cdf.leaf_day_mr  /
-				(stratum[0].epv.proj_lai 
-				* zone[0].metv.dayl*12.011e-9);
-			else
-				psnin.Rd = 0.0;
-			/*--------------------------------------------------------------*/
-			/* note multiply by 1000; accounted for in compute_farq_psn by a /1000 */
-			/*	this is done for numerical precision			*/
-			/*--------------------------------------------------------------*/
+				psnin[0].lnc = 0.0;
 			if (stratum[0].epv.proj_lai_shade > ZERO)
-				psnin.g = stratum[0].gs_shade *1000 / 1.6 / stratum[0].epv.proj_lai_shade;
+				psnin[1].g = stratum[0].gs_shade *1000 / 1.6 / stratum[0].epv.proj_lai_shade;
 			else
-				psnin.g = 0.0;
-			psnin.irad = stratum[0].ppfd_shade;
+				psnin[1].g = 0.0;
 			if ((stratum[0].cs.leafc > ZERO) && (stratum[0].epv.proj_lai_shade > ZERO))
-				psnin.lnc = stratum[0].ns.leafn / (stratum[0].cs.leafc * 1.0)
+				psnin[1].lnc = stratum[0].ns.leafn / (stratum[0].cs.leafc * 1.0)
 					/ stratum[0].epv.proj_sla_shade;
 			else
-				psnin.lnc = 0.0;
-			if ((psnin.lnc > 0.0) && (psnin.irad > 0.0)) {
-				if ( compute_farq_psn(&psnin, &psnout, 1)){
-					fprintf(stderr,
-						"FATAL ERROR: in canopy_stratum_daily_F error in farquhar");
-					exit(EXIT_FAILURE);
-				}
+				psnin[1].lnc = 0.0;
+			if (compute_farq_psn_batch(command_line[0].verbose_flag, 2,
+				psnin, psnout)){
+				fprintf(stderr,
+					"FATAL ERROR: in canopy_stratum_daily_F error in farquhar");
+				exit(EXIT_FAILURE);
 			}
-			else
-				psnout.A = 0.0;
-			assim_shade = psnout.A;
-			dC13_shade = psnout.dC13;
+			assim_sunlit = psnout[0].A;
+			dC13_sunlit = psnout[0].dC13;
+			assim_shade = psnout[1].A;
+			dC13_shade = psnout[1].dC13;
 			/*--------------------------------------------------------------*/
 			/* total actual psn						*/
 			/*--------------------------------------------------------------*/
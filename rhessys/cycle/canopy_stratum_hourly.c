@@ -48,6 +48,7 @@ void	canopy_stratum_hourly(
 	/*	Local Function Declaration				*/
 	/*--------------------------------------------------------------*/
 	void	*alloc(	size_t, char *, char *);
+	void	dealloc( void *, size_t, char *, char * );
 
 	double compute_hourly_rain_stored(
 		int,
@@ -74,6 +75,7 @@ void	canopy_stratum_hourly(
 	/*--------------------------------------------------------------*/
 	/*	Destroy the canopy stratum hourly object.					*/
 	/*--------------------------------------------------------------*/
-	free( stratum[0].hourly );
+	dealloc( stratum[0].hourly, 1 * sizeof(struct canopy_strata_hourly_object),
+		"hourly","canopy_stratum_hourly");
 	return;
 } /*end canopy_stratum_hourly.c*/
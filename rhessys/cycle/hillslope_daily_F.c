@@ -59,6 +59,8 @@ void		hillslope_daily_F(
 	/*--------------------------------------------------------------*/
 	/*  Local Function Declarations.                                */
 	/*--------------------------------------------------------------*/
+	void	profile_start( struct profile_object *, int );
+	void	profile_stop( struct profile_object *, int );
 	void zone_daily_F(
 		long,
 		struct world_object *,
@@ -102,6 +104,7 @@ void		hillslope_daily_F(
 	/*  baseflow calculations                                               */
 	/*----------------------------------------------------------------------*/
 	if (command_line[0].routing_flag == 0) {
+		profile_start(command_line[0].profile, PROFILE_TOP_MODEL);
 		hillslope[0].base_flow = top_model(
 			command_line[0].verbose_flag,
 			command_line[0].grow_flag,
@@ -114,6 +117,7 @@ void		hillslope_daily_F(
 			hillslope,
 			hillslope[0].zones,
 			current_date);
+		profile_stop(command_line[0].profile, PROFILE_TOP_MODEL);
 	}
 	else{
 		hillslope[0].base_flow = 0.0;
@@ -60,6 +60,8 @@ void		hillslope_daily_I(
 	/*--------------------------------------------------------------*/
 	/*  Local Function Declarations.                                */
 	/*--------------------------------------------------------------*/
+	void	profile_start( struct profile_object *, int );
+	void	profile_stop( struct profile_object *, int );
 	void zone_daily_I(
 		long,
 		struct world_object *,
@@ -97,6 +99,7 @@ void		hillslope_daily_I(
 	/*	mean storing all of the (numerous) daily parameters .		*/
 	/*--------------------------------------------------------------*/
 	for ( zone=0 ; zone<hillslope[0].num_zones; zone++ ){
+		profile_start(command_line[0].profile, PROFILE_ZONE_DAILY_I);
 		zone_daily_I( 	day,
 			world,
 			basin,
@@ -105,6 +108,7 @@ void		hillslope_daily_I(
 			command_line,
 			event,
 			current_date );
+		profile_stop(command_line[0].profile, PROFILE_ZONE_DAILY_I);
 	}
 	return;
 } /*end hillslopee_daily_I.c*/
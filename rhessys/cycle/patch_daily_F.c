@@ -91,6 +91,8 @@ void		patch_daily_F(
 	/*------------------------------------------------------*/
 	/*	Local Function Declarations.						*/
 	/*------------------------------------------------------*/
+	void	profile_start( struct profile_object *, int );
+	void	profile_stop( struct profile_object *, int );
 	void compute_Lstar(
 		int,
 		struct	basin_object	*basin,
@@ -496,6 +498,7 @@ void		patch_daily_F(
 			/*		Cycle through the canopy strata in this layer	*/
 			/*--------------------------------------------------------------*/
 			for ( stratum=0 ; stratum<patch[0].layers[layer].count; stratum++ ){
+					profile_start(command_line[0].profile, PROFILE_CANOPY_STRATUM_DAILY_F);
 					canopy_stratum_daily_F(
 						world,
 						basin,
@@ -507,6 +510,7 @@ void		patch_daily_F(
 						command_line,
 						event,
 						current_date );
+					profile_stop(command_line[0].profile, PROFILE_CANOPY_STRATUM_DAILY_F);
 			}
 			patch[0].Kdown_direct = patch[0].Kdown_direct_final;
 			patch[0].Kdown_diffuse = patch[0].Kdown_diffuse_final;
@@ -625,6 +629,7 @@ void		patch_daily_F(
 			patch[0].ga_final = patch[0].layers[layer].null_cover * patch[0].ga;
 			patch[0].wind_final = patch[0].layers[layer].null_cover * patch[0].wind;
 			for ( stratum=0 ;stratum<patch[0].layers[layer].count; stratum++ ){
+					profile_start(command_line[0].profile, PROFILE_CANOPY_STRATUM_DAILY_F);
 					canopy_stratum_daily_F(
 						world,
 						basin,
@@ -636,6 +641,7 @@ void		patch_daily_F(
 						command_line,
 						event,
 						current_date );
+					profile_stop(command_line[0].profile, PROFILE_CANOPY_STRATUM_DAILY_F);
 			}
 			patch[0].Kdown_direct = patch[0].Kdown_direct_final;
 			patch[0].Kdown_diffuse = patch[0].Kdown_diffuse_final;
@@ -664,6 +670,7 @@ void		patch_daily_F(
 			patch[0].ga_final = patch[0].layers[layer].null_cover * patch[0].ga;
 			patch[0].wind_final = patch[0].layers[layer].null_cover * patch[0].wind;
 			for ( stratum=0 ; stratum<patch[0].layers[layer].count; stratum++ ){
+					profile_start(command_line[0].profile, PROFILE_CANOPY_STRATUM_DAILY_F);
 					canopy_stratum_daily_F(
 						world,
 						basin,
@@ -675,6 +682,7 @@ void		patch_daily_F(
 						command_line,
 						event,
 						current_date );
+					profile_stop(command_line[0].profile, PROFILE_CANOPY_STRATUM_DAILY_F);
 			}
 			patch[0].Kdown_direct = patch[0].Kdown_direct_final;
 			patch[0].Kdown_diffuse = patch[0].Kdown_diffuse_final;
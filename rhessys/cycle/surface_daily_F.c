@@ -89,15 +89,17 @@ void		surface_daily_F(
 		int,
 		struct	patch_object *);
 	
-	double	penman_monteith(
+	void	penman_monteith_batch(
 		int,
 		double,
 		double,
-		double,
-		double,
-		double,
-		double,
-		int);
+		int,
+		double *,
+		double *,
+		double *,
+		double *,
+		int,
+		double *);
 
 
 	double  compute_subsurface_temperature_profile(
@@ -110,6 +112,7 @@ void		surface_daily_F(
 	/*--------------------------------------------------------------*/
 	/*  Local variable definition.                                  */
 	/*--------------------------------------------------------------*/
+	int	i;
 	double  detention_store_evaporation;
 	double  detention_store_potential_evaporation;
 	double  detention_store_potential_dry_evaporation_rate;
@@ -126,6 +129,7 @@ void		surface_daily_F(
 	double	rnet_evap, rnet_evap_pond, rnet_evap_litter, rnet_evap_soil;
 	double  rnet;
 	double	PE_rate, PE_rainy_rate;
+	double	pm_vpd[4], pm_rnet[4], pm_rs[4], pm_ra[4], pm_et[4];
 	double	soil_potential_evaporation;
 	double	soil_potential_dry_evaporation_rate;
 	double	soil_potential_rainy_evaporation_rate;
@@ -184,24 +188,26 @@ void		surface_daily_F(
 	
 			patch[0].ga = max((patch[0].ga * patch[0].stability_correction),0.0001);
 		
-			detention_store_potential_dry_evaporation_rate = penman_monteith(
-				command_line[0].verbose_flag,
-				zone[0].metv.tday,
-				zone[0].metv.pa,
-				zone[0].metv.vpd,
-				rnet_evap_pond,
-				0.0,
-				1/(patch[0].ga),
-				2) ;
-			detention_store_potential_rainy_evaporation_rate = penman_monteith(
+			pm_vpd[0] = zone[0].metv.vpd;
+			pm_vpd[1] = 10;
+			for (i=0; i < 2; i++) {
+				pm_rnet[i] = rnet_evap_pond;
+				pm_rs[i] = 0.0;
+				pm_ra[i] = 1/(patch[0].ga);
+			}
+			penman_monteith_batch(
 				command_line[0].verbose_flag,
 				zone[0].metv.tday,
 				zone[0].metv.pa,
-				10,
-				rnet_evap_pond,
-				0.0,
-				1/(patch[0].ga),
-				2) ;
+				2,
+				pm_vpd,
+				pm_rnet,
+				pm_rs,
+				pm_ra,
+				2,
+				pm_et);
+			detention_store_potential_dry_evaporation_rate = pm_et[0];
+			detention_store_potential_rainy_evaporation_rate = pm_et[1];
 	
 			detention_store_potential_evaporation  = detention_store_potential_dry_evaporation_rate
 					* (zone[0].metv.dayl - zone[0].daytime_rain_duration )
@@ -418,42 +424,29 @@ void		surface_daily_F(
 		/*	Estimate potential evap rates.				*/
 		/*--------------------------------------------------------------*/
 			
-		potential_evaporation_rate = penman_monteith(
-			command_line[0].verbose_flag,
-			zone[0].metv.tday,
-			zone[0].metv.pa,
-			zone[0].metv.vpd,
-			rnet_evap_litter,
-			1/patch[0].litter.gsurf,
-			1/(patch[0].ga),
-			2) ;
-		potential_rainy_evaporation_rate = penman_monteith(
-			command_line[0].verbose_flag,
-			zone[0].metv.tday,
-			zone[0].metv.pa,
-			10,
-			rnet_evap_litter,
-			1/patch[0].litter.gsurf,
-			1/(patch[0].ga),
-			2) ;
-		PE_rate = penman_monteith(
-			command_line[0].verbose_flag,
-			zone[0].metv.tday,
-			zone[0].metv.pa,
-			zone[0].metv.vpd,
-			rnet_evap_litter,
-			0.0,
-			1/(patch[0].ga),
-			2) ;
-		PE_rainy_rate = penman_monteith(
+		/*	litter with and without its surface resistance, dry and	*/
+		/*	rainy, share the air so go as one batch			*/
+		for (i=0; i < 4; i++) {
+			pm_vpd[i] = (i % 2 == 0) ? zone[0].metv.vpd : 10;
+			pm_rnet[i] = rnet_evap_litter;
+			pm_rs[i] = (i < 2) ? 1/patch[0].litter.gsurf : 0.0;
+			pm_ra[i] = 1/(patch[0].ga);
+		}
+		penman_monteith_batch(
 			command_line[0].verbose_flag,
 			zone[0].metv.tday,
 			zone[0].metv.pa,
-			10,
-			rnet_evap_litter,
-			0.0,
-			1/(patch[0].ga),
-			2) ;
+			4,
+			pm_vpd,
+			pm_rnet,
+			pm_rs,
+			pm_ra,
+			2,
+			pm_et);
+		potential_evaporation_rate = pm_et[0];
+		potential_rainy_evaporation_rate = pm_et[1];
+		PE_rate = pm_et[2];
+		PE_rainy_rate = pm_et[3];
 		
 		PE_rainy_rate = max(0, PE_rainy_rate);
 		PE_rate = max(0, PE_rate);
@@ -505,24 +498,26 @@ void		surface_daily_F(
 		/*	aasuming no litter covering the surface (0 m height).	*/
 		/*--------------------------------------------------------------*/
 		
-			soil_potential_rainy_evaporation_rate = penman_monteith(
-				command_line[0].verbose_flag,
-				zone[0].metv.tday,
-				zone[0].metv.pa,
-				10.0,
-				rnet_evap_soil,
-				1.0/patch[0].gsurf,
-				1.0/patch[0].ga,
-				2);
-			soil_potential_dry_evaporation_rate = penman_monteith(
+			pm_vpd[0] = 10.0;
+			pm_vpd[1] = zone[0].metv.vpd;
+			for (i=0; i < 2; i++) {
+				pm_rnet[i] = rnet_evap_soil;
+				pm_rs[i] = 1.0/patch[0].gsurf;
+				pm_ra[i] = 1.0/patch[0].ga;
+			}
+			penman_monteith_batch(
 				command_line[0].verbose_flag,
 				zone[0].metv.tday,
 				zone[0].metv.pa,
-				zone[0].metv.vpd,
-				rnet_evap_soil,
-				1.0/patch[0].gsurf,
-				1.0/patch[0].ga,
-				2);
+				2,
+				pm_vpd,
+				pm_rnet,
+				pm_rs,
+				pm_ra,
+				2,
+				pm_et);
+			soil_potential_rainy_evaporation_rate = pm_et[0];
+			soil_potential_dry_evaporation_rate = pm_et[1];
 			soil_potential_evaporation  = soil_potential_dry_evaporation_rate
 				* (zone[0].metv.dayl - zone[0].daytime_rain_duration )
 				+ soil_potential_rainy_evaporation_rate
@@ -46,6 +46,7 @@ void		world_daily_I(
 	/*  Local Function Declarations.                                */
 	/*--------------------------------------------------------------*/
 	int 	compute_year_day( struct date );
+	double	compute_declination( int );
 	void	basin_daily_I(
 		long,
 		struct world_object *,
@@ -60,13 +61,6 @@ void		world_daily_I(
 	int index;
 	double	Io_array[13] = { 0.0, 1445.0, 1431.0, 1410.0, 1389.0, 1368.0,1354.0,
 		1354.0, 1375.0, 1403.0, 1424.0, 1438.0, 1445.0 };
-	double	declination_array[47] = { 0.0, -23.0, -22.0, -21.0, -19.0,
-		-17.0, -15.0, -12.0, -9.0, -6.0, -3.0, 0.0, 3.0,
-		6.0, 9.0, 12.0, 14.0, 17.0, 19.0, 21.0, 22.0,
-		23.0, 23.5, 23.5, 23.0, 21.5, 20.0, 18.0, 16.0, 14.0,
-		12.0, 9.0, 6.0, 3.0, 0.0, -3.0, -6.0, -9.0, -12.0,
-		-15.0, -17.0, -19.0, -21.0, -22.0, -23.0, -23.5,
-		-23.5 };
 	
 	/*--------------------------------------------------------------*/
 	/*  Compute the solar constant.                                 */
@@ -96,11 +90,13 @@ void		world_daily_I(
 	/*  Equation from Linacre, Climate Data and Resources, p. 148.  */
 	/*  Approximation taken from C version of rhessys.              */
 	/*	We only store cos(declination) which we need on zone level.	*/
+	/*	The index also picks the day in the basin solar tables.		*/
 	/*--------------------------------------------------------------*/
 	index = (int) ( 1.0 + ((double)world[0].year_day)/8);
-	world[0].declin = declination_array[index]*DtoR;
-	world[0].cos_declin = cos(declination_array[index]*DtoR);
-	world[0].sin_declin = sin(declination_array[index]*DtoR);
+	world[0].declin_index = index;
+	world[0].declin = compute_declination(index);
+	world[0].cos_declin = cos(world[0].declin);
+	world[0].sin_declin = sin(world[0].declin);
 	/*--------------------------------------------------------------*/
 	/*	Simulate over all of the basins.							*/
 	/*--------------------------------------------------------------*/
@@ -140,6 +140,8 @@ void		zone_daily_F(
 	/*--------------------------------------------------------------*/
 	/*  Local Function Declarations.                                */
 	/*--------------------------------------------------------------*/
+	void	profile_start( struct profile_object *, int );
+	void	profile_stop( struct profile_object *, int );
 	void    patch_daily_F(
 		struct	world_object	*,
 		struct	basin_object	*,
@@ -545,15 +547,19 @@ void		zone_daily_F(
 	/*	Cycle through the patches for day end computations			*/
 	/*--------------------------------------------------------------*/
 	for ( patch=0 ; patch<zone[0].num_patches; patch++ ){
-		patch_daily_F(
-			world,
-			basin,
-			hillslope,
-			zone,
-			zone[0].patches[patch],
-			command_line,
-			event,
-			current_date );
+		if (zone[0].patches[patch][0].spinup_frozen == 0){
+			profile_start(command_line[0].profile, PROFILE_PATCH_DAILY_F);
+			patch_daily_F(
+				world,
+				basin,
+				hillslope,
+				zone,
+				zone[0].patches[patch],
+				command_line,
+				event,
+				current_date );
+			profile_stop(command_line[0].profile, PROFILE_PATCH_DAILY_F);
+		}
 	}
 
 	/*--------------------------------------------------------------*/
@@ -149,6 +149,8 @@ void zone_daily_I(
 	/*--------------------------------------------------------------*/
 	/*  Local Function Declarations.                                */
 	/*--------------------------------------------------------------*/
+	void	profile_start( struct profile_object *, int );
+	void	profile_stop( struct profile_object *, int );
 	void patch_daily_I(
 		struct	world_object	*,
 		struct	basin_object	*,
@@ -160,9 +162,11 @@ void zone_daily_I(
 		struct date);
 
 
-	double normdist(double, double);
+	double normdist(double, double, unsigned long, long, long, int);
 
-	double unifdist(double, double);
+	double unifdist(double, double, unsigned long, long, long, int);
+
+	long	julday( struct date );
 
 		
 	/*--------------------------------------------------------------*/
@@ -220,22 +224,27 @@ void zone_daily_I(
 
 		/*--------------------------------------------------------------*/
 		/* 	allow for stocastic noise in precip scaling 		*/
+		/*	draws are keyed by seed, zone, day and base station	*/
 		/*--------------------------------------------------------------*/
 		if ((command_line[0].precip_scale_flag > 0) && (temp > 0.0)) {
 
 			if (temp < zone[0].defaults[0][0].psen[PTHRESH])   {
 				if (zone[0].defaults[0][0].psen[PTYPELOW] > 0) 
-					isohyet_adjustment = exp(normdist(zone[0].defaults[0][0].psen[P1LOW], zone[0].defaults[0][0].psen[P2LOW]))*z_delta + 1.0;
+					isohyet_adjustment = exp(normdist(zone[0].defaults[0][0].psen[P1LOW], zone[0].defaults[0][0].psen[P2LOW],
+						command_line[0].seed, zone[0].ID, julday(current_date), i))*z_delta + 1.0;
 				else
-					isohyet_adjustment = z_delta * unifdist(zone[0].defaults[0][0].psen[P1LOW], zone[0].defaults[0][0].psen[P2LOW]) + 1;
+					isohyet_adjustment = z_delta * unifdist(zone[0].defaults[0][0].psen[P1LOW], zone[0].defaults[0][0].psen[P2LOW],
+						command_line[0].seed, zone[0].ID, julday(current_date), i) + 1;
 			}
 			else {
 				if (zone[0].defaults[0][0].psen[PTYPEHIGH] > 0) 
 				
-					isohyet_adjustment = exp(normdist(zone[0].defaults[0][0].psen[P1HIGH], zone[0].defaults[0][0].psen[P2HIGH]))*z_delta + 1.0;
+					isohyet_adjustment = exp(normdist(zone[0].defaults[0][0].psen[P1HIGH], zone[0].defaults[0][0].psen[P2HIGH],
+						command_line[0].seed, zone[0].ID, julday(current_date), i))*z_delta + 1.0;
 						
 				else
-					isohyet_adjustment = z_delta * unifdist(zone[0].defaults[0][0].psen[P1HIGH], zone[0].defaults[0][0].psen[P2HIGH]) + 1;
+					isohyet_adjustment = z_delta * unifdist(zone[0].defaults[0][0].psen[P1HIGH], zone[0].defaults[0][0].psen[P2HIGH],
+						command_line[0].seed, zone[0].ID, julday(current_date), i) + 1;
 			}
 
 			if (isohyet_adjustment < ZERO) 
@@ -871,14 +880,18 @@ void zone_daily_I(
 	/*	Cycle through the patches 									*/
 	/*--------------------------------------------------------------*/
 	for ( patch=0 ; patch<zone[0].num_patches; patch++ ){
-		patch_daily_I(
-			world,
-			basin,
-			hillslope,
-			zone,
-			zone[0].patches[patch],
-			command_line,
-			event,
-			current_date );
+		if (zone[0].patches[patch][0].spinup_frozen == 0){
+			profile_start(command_line[0].profile, PROFILE_PATCH_DAILY_I);
+			patch_daily_I(
+				world,
+				basin,
+				hillslope,
+				zone,
+				zone[0].patches[patch],
+				command_line,
+				event,
+				current_date );
+			profile_stop(command_line[0].profile, PROFILE_PATCH_DAILY_I);
+		}
 	}
 } /*end zone_daily_I.c*/
@@ -42,6 +42,7 @@
 /*--------------------------------------------------------------*/
 #include <stdio.h>
 #include "rhessys.h"
+#include "fast_math.h"
 
 void		zone_hourly(
 						struct	world_object 	*world,
@@ -138,7 +139,7 @@ void		zone_hourly(
 			/*		Atmospheric attenuation to direct radiation	(no units)  */
 			/*--------------------------------------------------------------*/
 			zone[0].hourly[0].direct_attenuation
-				= pow( zone[0].atm_trans, basin[0].hourly[0].optical_air_mass);
+				= POW( zone[0].atm_trans, basin[0].hourly[0].optical_air_mass);
 			/*--------------------------------------------------------------*/
 			/*		Downwelling total irradiance at BOA along sza			*/
 			/*		W / m ** 2  = W /m ** 2  								*/
@@ -201,17 +202,15 @@ void		zone_hourly(
 					/*     Cosine of beam slope angle. (no units)                  */
 					/*                                                             */
 					/*     Eq. 8 Appendix D of "MTCLIM"                            */
+					/*     with the slope, aspect and latitude terms kept in the   */
+					/*     zone by construct_solar_ephemeris                       */
 					/*-------------------------------------------------------------*/
 					zone[0].hourly[0].cos_beam_slope
-						= -1 * zone[0].sin_slope * zone[0].sin_aspect
+						= zone[0].beam_slope_sin_hourangle
 						* basin[0].hourly[0].cos_declin_sin_hourangle
-						+ ( -1 * zone[0].cos_aspect * zone[0].sin_slope
-						* basin[0].sin_latitude + zone[0].cos_slope
-						* basin[0].cos_latitude)
+						+ zone[0].beam_slope_cos_hourangle
 						* basin[0].hourly[0].cos_declin_cos_hourangle
-						+( zone[0].cos_aspect * zone[0].sin_slope
-						* basin[0].cos_latitude + zone[0].cos_slope
-						* basin[0].sin_latitude ) * world[0].sin_declin;
+						+ zone[0].beam_slope_sin_declin * world[0].sin_declin;
 					/*-------------------------------------------------------------*/
 					/*	if sun angle is below the slope angle then		*/
 					/*	hill is blocking sun and Kdown_direct is zero		*/
@@ -246,7 +245,7 @@ void		zone_hourly(
 							= temp * (1.0 - temp / Kdown_direct_flat_toa);
 					zone[0].hourly[0].Kdown_diffuse
 						= zone[0].hourly[0].Kdown_diffuse_flat
-						* pow(cos(zone[0].slope/2.0),2.0);
+						* zone[0].sky_view_factor;
 					if ( command_line[0].verbose_flag > 5 )
 						printf("\n-111.3 cos_sza : %8.4f Kdown_dir_flat= %8.4f Kdown_dif_flat= %8.4f ",
 						basin[0].hourly[0].cos_sza,
@@ -279,15 +278,16 @@ void		zone_hourly(
 		/*	Cycle through the patches 									*/
 		/*--------------------------------------------------------------*/
 		for ( patch=0 ; patch<zone[0].num_patches; patch++ ){
-			patch_hourly(
-				world,
-				basin,
-				hillslope,
-				zone,
-				zone[0].patches[patch],
-				command_line,
-				event,
-				current_date );
+			if (zone[0].patches[patch][0].spinup_frozen == 0)
+				patch_hourly(
+					world,
+					basin,
+					hillslope,
+					zone,
+					zone[0].patches[patch],
+					command_line,
+					event,
+					current_date );
 		}
 		return;
 } /*end zone_hourly.c*/
@@ -0,0 +1,66 @@
+/*--------------------------------------------------------------*/
+/* 								*/
+/*		check_routing_active				*/
+/*								*/
+/*	NAME							*/
+/*	check_routing_active - tests whether routing a patch	*/
+/*		this step can change any store			*/
+/*		(-routing_active_tol)				*/
+/*								*/
+/*	SYNOPSIS						*/
+/*	int	check_routing_active(				*/
+/*			struct patch_object *)			*/
+/*								*/
+/*	returns:						*/
+/*	1 if update_drainage_land must run for the patch, 0 if	*/
+/*	it only moves the outflow already found to be below tol	*/
+/*								*/
+/*	OPTIONS							*/
+/*								*/
+/*	DESCRIPTION						*/
+/*								*/
+/*	Besides routing its saturated outflow,			*/
+/*	update_drainage_land turns return flow into detention	*/
+/*	store, routes detention store above its capacity, and	*/
+/*	infiltrates whatever is ponded on each surface		*/
+/*	neighbour.  A patch is active if any of these can	*/
+/*	happen:							*/
+/*								*/
+/*	- it is saturated to the surface (return flow),		*/
+/*	- its detention store exceeds detention_store_size, or	*/
+/*	- a surface neighbour, at any innundation depth, has	*/
+/*	  water ponded.						*/
+/*								*/
+/*	PROGRAMMER NOTES					*/
+/*								*/
+/*	The saturated outflow test is made by			*/
+/*	compute_subsurface_routing from the patch's last	*/
+/*	routed step.						*/
+/*								*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include "rhessys.h"
+
+int	check_routing_active( struct patch_object *patch)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.				*/
+	/*--------------------------------------------------------------*/
+	int	d, j, num_depths;
+
+	if ((patch[0].sat_deficit - patch[0].rz_storage
+		- patch[0].unsat_storage) < -1.0*ZERO)
+		return(1);
+	if (patch[0].detention_store
+		> patch[0].soil_defaults[0][0].detention_store_size)
+		return(1);
+	num_depths = max(patch[0].num_innundation_depths, 1);
+	for (d = 0; d < num_depths; d++) {
+		for (j = 0; j < patch[0].surface_innundation_list[d].num_neighbours; j++) {
+			if (patch[0].surface_innundation_list[d].neighbours[j].patch[0].detention_store
+				> ZERO)
+				return(1);
+		}
+	}
+	return(0);
+} /*end check_routing_active*/
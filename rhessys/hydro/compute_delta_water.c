@@ -42,11 +42,15 @@
 /*								*/
 /*	PROGRAMMER NOTES					*/
 /*								*/
+/*	With -soiltable the integral is taken from the profile	*/
+/*	table for n_0, p and soil_depth (soil_profile_table.c)	*/
+/*	where both depths are within the soil.			*/
 /*								*/
 /*--------------------------------------------------------------*/
 #include <stdio.h>
 #include <math.h>
 #include "rhessys.h"
+#include "fast_math.h"
 
 double	compute_delta_water(
 							int	verbose_flag,
@@ -59,11 +63,19 @@ double	compute_delta_water(
 	/*--------------------------------------------------------------*/
 	/*	Local function declaration									*/
 	/*--------------------------------------------------------------*/
+	struct	soil_profile_table	*find_soil_profile_table(
+		double,
+		double,
+		double);
+	double	soil_profile_storage(
+		struct soil_profile_table *,
+		double);
 	
 	/*--------------------------------------------------------------*/
 	/*	Local variable definition.									*/
 	/*--------------------------------------------------------------*/
 	double	delta_water;
+	struct	soil_profile_table	*table;
 	
 	/*--------------------------------------------------------------*/
 	/*	User defined function relating water table depth change */
@@ -91,9 +103,14 @@ double	compute_delta_water(
 	/*--------------------------------------------------------------*/
 	z_final = min(max(z_final,0),soil_depth);
 	z_initial = max(z_initial,0);
-	if ( ( p != 0 ) && (p < 999.0) ){
+	if ( (z_initial <= soil_depth)
+		&& ((table = find_soil_profile_table(n_0, p, soil_depth)) != NULL) ){
+		delta_water += soil_profile_storage(table, z_initial)
+			- soil_profile_storage(table, z_final);
+	}
+	else if ( ( p != 0 ) && (p < 999.0) ){
 		delta_water += n_0 * p *
-			(exp(-z_final/p) - exp(-z_initial/p));
+			(EXP(-z_final/p) - EXP(-z_initial/p));
 	}
 	else{
 		delta_water += n_0 * (z_initial - z_final );
@@ -0,0 +1,141 @@
+/*--------------------------------------------------------------*/
+/* 								*/
+/*		compute_routing_timesteps			*/
+/*								*/
+/*	NAME							*/
+/*	compute_routing_timesteps - chooses the number of	*/
+/*		subsurface routing steps for the day		*/
+/*		(-adaptroute)					*/
+/*								*/
+/*	SYNOPSIS						*/
+/*	int	compute_routing_timesteps(			*/
+/*			struct command_line_object *,		*/
+/*			struct basin_object *)			*/
+/*								*/
+/*	returns:						*/
+/*	number of routing steps for compute_subsurface_routing	*/
+/*								*/
+/*	OPTIONS							*/
+/*								*/
+/*	DESCRIPTION						*/
+/*								*/
+/*	For each patch in the basin routing list, estimates	*/
+/*	the day's saturated outflow q (m) at the current	*/
+/*	sat_deficit s with the same transmissivity and gamma	*/
+/*	as update_drainage_land, capped by the water held	*/
+/*	below the water table (soil_water_cap - s).  A patch	*/
+/*	with n steps drains q/n per step, and n is the		*/
+/*	smallest number, doubling from the minimum, for which	*/
+/*								*/
+/*	- q/n is at most tol of the water below the water	*/
+/*	  table, and						*/
+/*	- the outflow at s + q/n differs from q by at most	*/
+/*	  tol of q, i.e. the flux changes little within a	*/
+/*	  step as the water table drops.			*/
+/*								*/
+/*	The basin takes the largest n over its patches,		*/
+/*	clamped to the -adaptroute minimum and maximum.		*/
+/*	Dry days with deep water tables and little		*/
+/*	transmissivity take the minimum; days after storms	*/
+/*	with shallow water tables take more steps.		*/
+/*								*/
+/*	Overland flow of ponded water (detention store above	*/
+/*	its capacity) and return flow move one patch per step,	*/
+/*	so their travel time is set by the basin default	*/
+/*	n_routing_timesteps.  A day on which any patch has	*/
+/*	either takes at least that many steps.			*/
+/*								*/
+/*	The day's choice and a running tally are kept in the	*/
+/*	basin and reported at the end of the run.		*/
+/*								*/
+/*	PROGRAMMER NOTES					*/
+/*								*/
+/*	Infiltration and vertical drainage run once a day in	*/
+/*	compute_subsurface_routing and keep the basin default	*/
+/*	step length whatever is chosen here.			*/
+/*								*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <math.h>
+#include "rhessys.h"
+
+int	compute_routing_timesteps(
+				struct command_line_object *command_line,
+				struct basin_object *basin)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local function definition.				*/
+	/*--------------------------------------------------------------*/
+	double	compute_varbased_flow(
+		struct patch_object *,
+		double,
+		double,
+		double);
+	double	recompute_gamma(
+		struct patch_object *,
+		double);
+
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.				*/
+	/*--------------------------------------------------------------*/
+	int	i, n, n_patch, n_min, n_max, n_surface;
+	double	tol, std, gamma, q, q_step, available_water;
+	struct	patch_object	*patch;
+
+	n_min = command_line[0].routing_substeps[0];
+	n_max = command_line[0].routing_substeps[1];
+	tol = command_line[0].routing_substep_tol;
+	n_surface = min(max(basin[0].defaults[0][0].n_routing_timesteps, n_min),
+		n_max);
+	n = n_min;
+	for (i = 0; i < basin->route_list->num_patches; i++) {
+		patch = basin->route_list->list[i];
+		/*--------------------------------------------------------------*/
+		/*	ponded water or return flow moves one patch per step	*/
+		/*--------------------------------------------------------------*/
+		if ( (patch[0].detention_store
+			> patch[0].soil_defaults[0][0].detention_store_size)
+			|| (patch[0].sat_deficit - patch[0].rz_storage
+			- patch[0].unsat_storage < ZERO) )
+			n = max(n, n_surface);
+		gamma = recompute_gamma(patch, patch[0].innundation_list[0].gamma);
+		if (gamma <= ZERO)
+			continue;
+		std = patch[0].std * command_line[0].std_scale;
+		q = compute_varbased_flow(patch, std, patch[0].sat_deficit, gamma)
+			/ patch[0].area;
+		available_water = max(patch[0].soil_defaults[0][0].soil_water_cap
+			- max(patch[0].sat_deficit, 0.0), 0.0);
+		q = min(q, available_water);
+		if (q <= ZERO)
+			continue;
+		for (n_patch = n; n_patch < n_max; n_patch *= 2) {
+			q_step = q / n_patch;
+			if ( (q_step <= tol * available_water)
+				&& (fabs(compute_varbased_flow(patch, std,
+				patch[0].sat_deficit + q_step, gamma) / patch[0].area - q)
+				<= tol * q) )
+				break;
+		}
+		n = min(n_patch, n_max);
+		if (n == n_max)
+			break;
+	}
+	/*--------------------------------------------------------------*/
+	/*	tally the choice					*/
+	/*--------------------------------------------------------------*/
+	basin[0].n_routing_substeps = n;
+	if ( (basin[0].routing_substep_days == 0)
+		|| (n < basin[0].routing_substep_min) )
+		basin[0].routing_substep_min = n;
+	if ( (basin[0].routing_substep_days == 0)
+		|| (n > basin[0].routing_substep_max) )
+		basin[0].routing_substep_max = n;
+	if (n <= 2)
+		basin[0].routing_substep_dry_days += 1;
+	basin[0].routing_substep_days += 1;
+	basin[0].routing_substep_total += n;
+	if (command_line[0].verbose_flag > 1)
+		printf("\n basin %d routing substeps %d", basin[0].ID, n);
+	return(n);
+} /*end compute_routing_timesteps*/
@@ -0,0 +1,110 @@
+/*--------------------------------------------------------------*/
+/* 								*/
+/*		compute_smoothed_transmissivity			*/
+/*								*/
+/*	NAME							*/
+/*	compute_smoothed_transmissivity - tabulates the		*/
+/*		transmissivity curve averaged over a normal	*/
+/*		distribution of saturation deficits (-stdev)	*/
+/*								*/
+/*	SYNOPSIS						*/
+/*	void	compute_smoothed_transmissivity(		*/
+/*				struct patch_object *,		*/
+/*				double	)			*/
+/*								*/
+/*	OPTIONS							*/
+/*	patch - patch with a transmissivity_profile		*/
+/*	std - (m) standard deviation of sat_deficit		*/
+/*								*/
+/*	DESCRIPTION						*/
+/*								*/
+/*	compute_varbased_flow averages the transmissivity	*/
+/*	profile over 9 quadrature points of a normal		*/
+/*	distribution of sat_deficit around its mean s1.		*/
+/*	Since the quadrature is fixed, the average depends	*/
+/*	only on s1, so it is tabulated here once per patch at	*/
+/*	each soil interval:					*/
+/*								*/
+/*	smoothed[j] = sum_i perc[i] *				*/
+/*		transmissivity[lround(j + normal[i]*std/dz)]	*/
+/*								*/
+/*	and compute_varbased_flow interpolates it linearly.	*/
+/*	The table runs past the soil bottom until every		*/
+/*	quadrature point is clamped to the last interval.	*/
+/*	Points above the surface take the surface value.	*/
+/*								*/
+/*	Called by construct_routing_topology after the		*/
+/*	transmissivity curve, and by compute_varbased_flow	*/
+/*	when std is not the one the table was built for, in	*/
+/*	which case the old table is freed.			*/
+/*								*/
+/*	PROGRAMMER NOTES					*/
+/*								*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <math.h>
+#include "rhessys.h"
+
+void	compute_smoothed_transmissivity(
+				struct patch_object *patch,
+				double std)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local function definition.				*/
+	/*--------------------------------------------------------------*/
+	void	*alloc( size_t, char *, char *);
+	void	dealloc( void *, size_t, char *, char *);
+
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.				*/
+	/*--------------------------------------------------------------*/
+	int	i, j, didx, num_intervals;
+	double	interval_size, flow;
+	double	normal[9], perc[9];
+	double	*smoothed;
+
+	normal[0] = 0;
+	normal[1] = 0.253;
+	normal[2] = 0.524;
+	normal[3] = 0.842;
+	normal[4] = 1.283;
+	normal[5] = -0.253;
+	normal[6] = -0.524;
+	normal[7] = -0.842;
+	normal[8] = -1.283;
+
+	perc[0] = 0.2;
+	for (i=1; i<9; i++)
+		perc[i] = 0.1;
+
+	if (patch[0].smoothed_transmissivity_profile != NULL)
+		dealloc(patch[0].smoothed_transmissivity_profile,
+			(patch[0].num_smoothed_intervals+1) * sizeof(double),
+			"smoothed_trans","compute_smoothed_transmissivity");
+	patch[0].smoothed_transmissivity_profile = NULL;
+	patch[0].num_smoothed_intervals = 0;
+	patch[0].smoothed_transmissivity_std = std;
+	if ( (std <= ZERO) || (patch[0].transmissivity_profile == NULL) )
+		return;
+
+	interval_size = patch[0].soil_defaults[0][0].interval_size;
+	num_intervals = patch[0].num_soil_intervals
+		+ (int) ceil(normal[4]*std/interval_size) + 1;
+	smoothed = (double *) alloc((num_intervals+1) * sizeof(double),
+		"smoothed_trans","compute_smoothed_transmissivity");
+	for (j=0; j <= num_intervals; j++) {
+		flow = 0.0;
+		for (i=0; i <9; i++) {
+			didx = (int) lround((j*interval_size + normal[i]*std)
+				/interval_size);
+			if (didx > patch[0].num_soil_intervals)
+				didx = patch[0].num_soil_intervals;
+			if (didx < 0) didx = 0;
+			flow += patch[0].transmissivity_profile[didx] * perc[i];
+		}
+		smoothed[j] = flow;
+	}
+	patch[0].smoothed_transmissivity_profile = smoothed;
+	patch[0].num_smoothed_intervals = num_intervals;
+	return;
+} /*compute_smoothed_transmissivity*/
@@ -31,6 +31,7 @@
 /*--------------------------------------------------------------*/
 #include <stdio.h>
 #include "rhessys.h"
+#include "fast_math.h"
 #include <math.h>
 
 
@@ -225,8 +226,8 @@ double nonlinear_kimetic_wave(double alfa,double Qin,double initial_flow,double
 	
          epsi=0.00001*c;
 	 do{
-		 fk=(dt/dx)*qk+alfa*pow(qk,beta)-c;
-	 f1=(dt/dx)+alfa*beta*pow(qk,(beta-1));
+		 fk=(dt/dx)*qk+alfa*POW(qk,beta)-c;
+	 f1=(dt/dx)+alfa*beta*POW(qk,(beta-1));
 	 qk1=qk-fk/f1;
 	 k=k+1;
        
@@ -236,7 +237,7 @@ double nonlinear_kimetic_wave(double alfa,double Qin,double initial_flow,double
 	 for(ilm=1;ilm<=mlm;ilm++){
 		 alam=1.0/pow(2.0,(ilm-1));
 		 Qout=alam*qk1+(1-alam)*qk;
-		 f=(dt/dx)*Qout+alfa*pow(Qout,beta)-c;
+		 f=(dt/dx)*Qout+alfa*POW(Qout,beta)-c;
         
 		 if(abs(f)<=epsi || abs(f)<=epsi0)
                     goto _jumpout;
@@ -53,8 +53,10 @@ void compute_subsurface_routing(struct command_line_object *command_line,
 
 	double compute_z_final(int, double, double, double, double, double);
 
-	double compute_N_leached(int, double, double, double, double, double,
-			double, double, double, double, double, double, double);
+	int check_routing_active(struct patch_object *);
+
+	void compute_solutes_leached(int, struct soil_default *, double *, double,
+			double, double, double *);
 
 	double compute_layer_field_capacity(int, int, double, double, double,
 			double, double, double, double, double, double);
@@ -68,11 +70,13 @@ void compute_subsurface_routing(struct command_line_object *command_line,
 	int i, d;
 	int j, k;
 	int grow_flag, verbose_flag;
-	double time_int, tmp;
+	int n_vertical, active_flag, routed_in, num_routed;
+	double time_int, vertical_int, active_tol, patch_int, tmp;
 	double scale;
 	double theta, m, Ksat, Nout;
 	double NO3_out, NH4_out, DON_out, DOC_out;
 	double return_flow, excess;
+	double total[NUM_LEACH_SOLUTES], leached[NUM_LEACH_SOLUTES]; /* kg/m2 */
 	double water_balance, infiltration;
 	double innundation_depth;
 	double basin_outflow;
@@ -100,6 +104,19 @@ void compute_subsurface_routing(struct command_line_object *command_line,
 	verbose_flag = command_line[0].verbose_flag;
 
 	time_int = 1.0 / n_timesteps;
+	/*--------------------------------------------------------------*/
+	/*	infiltration and vertical drainage run once, on the	*/
+	/*	last step, for the basin default step length; they keep	*/
+	/*	it when -adaptroute changes the number of routing steps	*/
+	/*--------------------------------------------------------------*/
+	n_vertical = basin[0].defaults[0][0].n_routing_timesteps;
+	vertical_int = 1.0 / n_vertical;
+	/*--------------------------------------------------------------*/
+	/*	-routing_active_tol (m/day) as a depth per step		*/
+	/*--------------------------------------------------------------*/
+	active_flag = command_line[0].routing_active_flag;
+	active_tol = command_line[0].routing_active_tol * time_int;
+	num_routed = 0;
 	basin_outflow = 0.0;
 	basin_area = 0.0;
 	basin_unsat_storage = 0.0;
@@ -137,6 +154,8 @@ void compute_subsurface_routing(struct command_line_object *command_line,
 		patch[0].Qout = 0.0;
 		patch[0].surface_Qin = 0.0;
 		patch[0].surface_Qout = 0.0;
+		patch[0].routing_active = 1;
+		patch[0].routing_skipped = 0;
 
 		patch[0].preday_sat_deficit = patch[0].sat_deficit;
 
@@ -195,6 +214,34 @@ void compute_subsurface_routing(struct command_line_object *command_line,
 		for (i = 0; i < basin->route_list->num_patches; i++) {
 			patch = basin->route_list->list[i];
 			/*--------------------------------------------------------------*/
+			/*	with -routing_active_tol, land patches whose last	*/
+			/*	routed outflow was below tol and whose stores have	*/
+			/*	not changed since are skipped; the first and last	*/
+			/*	steps route every patch.  The outflow of skipped	*/
+			/*	steps is owed and routed, in one longer step, the	*/
+			/*	next time the patch is routed			*/
+			/*--------------------------------------------------------------*/
+			patch_int = time_int;
+			if ((active_flag == 1)
+					&& (patch[0].drainage_type != STREAM)
+					&& ((patch[0].drainage_type != ROAD)
+					|| (command_line[0].road_flag != 1))) {
+				if ((patch[0].routing_active == 0) && (k > 0)
+						&& (k < (n_timesteps - 1)))
+					patch[0].routing_active = check_routing_active(patch);
+				if ((patch[0].routing_active == 0) && (k > 0)
+						&& (k < (n_timesteps - 1))) {
+					if (patch[0].routing_skipped >= 0)
+						patch[0].routing_skipped += 1;
+					continue;
+				}
+				if (patch[0].routing_skipped > 0)
+					patch_int = time_int * (1 + patch[0].routing_skipped);
+				patch[0].routing_skipped = 0;
+			}
+			patch[0].routing_active = 1;
+			num_routed++;
+			/*--------------------------------------------------------------*/
 			/*	for roads, saturated throughflow beneath road cut	*/
 			/*	is routed to downslope patches; saturated throughflow	*/
 			/*	above the cut and overland flow is routed to the stream	*/
@@ -211,7 +258,7 @@ void compute_subsurface_routing(struct command_line_object *command_line,
 				update_drainage_stream(patch, command_line, time_int,
 						verbose_flag);
 			} else {
-				update_drainage_land(patch, command_line, time_int,
+				update_drainage_land(patch, command_line, patch_int,
 						verbose_flag);
 			}
 
@@ -224,6 +271,20 @@ void compute_subsurface_routing(struct command_line_object *command_line,
 		for (i = 0; i < basin->route_list->num_patches; i++) {
 			patch = basin->route_list->list[i];
 
+			/*--------------------------------------------------------------*/
+			/*	a patch left out of this step with nothing routed in	*/
+			/*	and nothing ponded has no store to update		*/
+			/*--------------------------------------------------------------*/
+			if ((active_flag == 1) && (patch[0].routing_active == 0)
+					&& (patch[0].Qin == 0.0) && (patch[0].surface_Qin == 0.0)
+					&& (patch[0].detention_store <= ZERO)
+					&& ((grow_flag == 0)
+					|| ((patch[0].soil_ns.NO3_Qin == 0.0)
+					&& (patch[0].soil_ns.NH4_Qin == 0.0)
+					&& (patch[0].soil_ns.DON_Qin == 0.0)
+					&& (patch[0].soil_cs.DOC_Qin == 0.0))))
+				continue;
+
 			/*--------------------------------------------------------------*/
 			/*	update subsurface 				*/
 			/*-------------------------------------------------------------------------*/
@@ -268,6 +329,28 @@ void compute_subsurface_routing(struct command_line_object *command_line,
 						min(patch[0].rz_storage / patch[0].sat_deficit, 1.0);
 			}
 
+			/*--------------------------------------------------------------*/
+			/*	-routing_active_tol: route the patch next step if its	*/
+			/*	outflow reached tol or water was routed into it;	*/
+			/*	a skipped patch with no outflow owes nothing		*/
+			/*--------------------------------------------------------------*/
+			if (active_flag == 1) {
+				routed_in = ((patch[0].Qin > 0.0) || (patch[0].surface_Qin > 0.0)
+						|| ((grow_flag > 0)
+						&& ((patch[0].soil_ns.NO3_Qin > 0.0)
+						|| (patch[0].soil_ns.NH4_Qin > 0.0)
+						|| (patch[0].soil_ns.DON_Qin > 0.0)
+						|| (patch[0].soil_cs.DOC_Qin > 0.0))));
+				if (patch[0].routing_active == 1) {
+					patch[0].routing_active = (routed_in
+							|| ((patch[0].Qout + patch[0].surface_Qout) > active_tol));
+					if ((patch[0].routing_active == 0) && (patch[0].Qout <= 0.0))
+						patch[0].routing_skipped = -1;
+				}
+				else
+					patch[0].routing_active = routed_in;
+			}
+
 			/*--------------------------------------------------------------*/
 			/*	reset iterative  patch fluxes to zero			*/
 			/*--------------------------------------------------------------*/
@@ -346,69 +429,26 @@ void compute_subsurface_routing(struct command_line_object *command_line,
 					patch[0].rz_storage = 0.0;
 
 					if (grow_flag > 0) {
-						Nout =
-								compute_N_leached(verbose_flag,
-										patch[0].soil_cs.DOC, excess, 0.0, 0.0,
-										patch[0].m,
-										patch[0].innundation_list[d].gamma
-												/ patch[0].area * time_int,
-										patch[0].soil_defaults[0][0].porosity_0,
-										patch[0].soil_defaults[0][0].porosity_decay,
-										patch[0].soil_defaults[0][0].DOM_decay_rate,
-										patch[0].soil_defaults[0][0].active_zone_z,
-										patch[0].soil_defaults[0][0].soil_depth,
-										patch[0].soil_defaults[0][0].DOC_adsorption_rate);
-						patch[0].surface_DOC += Nout;
-						patch[0].soil_cs.DOC -= Nout;
-					}
-					if (grow_flag > 0) {
-						Nout =
-								compute_N_leached(verbose_flag,
-										patch[0].soil_ns.DON, excess, 0.0, 0.0,
-										patch[0].m,
-										patch[0].innundation_list[d].gamma
-												/ patch[0].area * time_int,
-										patch[0].soil_defaults[0][0].porosity_0,
-										patch[0].soil_defaults[0][0].porosity_decay,
-										patch[0].soil_defaults[0][0].DOM_decay_rate,
-										patch[0].soil_defaults[0][0].active_zone_z,
-										patch[0].soil_defaults[0][0].soil_depth,
-										patch[0].soil_defaults[0][0].DON_adsorption_rate);
-						patch[0].surface_DON += Nout;
-						patch[0].soil_ns.DON -= Nout;
-					}
-					if (grow_flag > 0) {
-						Nout =
-								compute_N_leached(verbose_flag,
-										patch[0].soil_ns.nitrate, excess, 0.0,
-										0.0, patch[0].m,
-										patch[0].innundation_list[d].gamma
-												/ patch[0].area * time_int,
-										patch[0].soil_defaults[0][0].porosity_0,
-										patch[0].soil_defaults[0][0].porosity_decay,
-										patch[0].soil_defaults[0][0].N_decay_rate,
-										patch[0].soil_defaults[0][0].active_zone_z,
-										patch[0].soil_defaults[0][0].soil_depth,
-										patch[0].soil_defaults[0][0].NO3_adsorption_rate);
-						patch[0].surface_NO3 += Nout;
-						patch[0].soil_ns.nitrate -= Nout;
-					}
-
-					if (grow_flag > 0) {
-						Nout =
-								compute_N_leached(verbose_flag,
-										patch[0].soil_ns.sminn, excess, 0.0,
-										0.0, patch[0].m,
-										patch[0].innundation_list[d].gamma
-												/ patch[0].area * time_int,
-										patch[0].soil_defaults[0][0].porosity_0,
-										patch[0].soil_defaults[0][0].porosity_decay,
-										patch[0].soil_defaults[0][0].N_decay_rate,
-										patch[0].soil_defaults[0][0].active_zone_z,
-										patch[0].soil_defaults[0][0].soil_depth,
-										patch[0].soil_defaults[0][0].NH4_adsorption_rate);
-						patch[0].surface_NH4 += Nout;
-						patch[0].soil_ns.sminn -= Nout;
+						total[LEACH_NO3] = patch[0].soil_ns.nitrate;
+						total[LEACH_NH4] = patch[0].soil_ns.sminn;
+						total[LEACH_DON] = patch[0].soil_ns.DON;
+						total[LEACH_DOC] = patch[0].soil_cs.DOC;
+						compute_solutes_leached(
+							verbose_flag,
+							patch[0].soil_defaults[0],
+							total,
+							excess,
+							0.0,
+							0.0,
+							leached);
+						patch[0].surface_DOC += leached[LEACH_DOC];
+						patch[0].soil_cs.DOC -= leached[LEACH_DOC];
+						patch[0].surface_DON += leached[LEACH_DON];
+						patch[0].soil_ns.DON -= leached[LEACH_DON];
+						patch[0].surface_NO3 += leached[LEACH_NO3];
+						patch[0].soil_ns.nitrate -= leached[LEACH_NO3];
+						patch[0].surface_NH4 += leached[LEACH_NH4];
+						patch[0].soil_ns.sminn -= leached[LEACH_NH4];
 					}
 				}
 
@@ -634,7 +674,7 @@ void compute_subsurface_routing(struct command_line_object *command_line,
 								patch[0].soil_defaults[0][0].mz_v,
 								patch[0].soil_defaults[0][0].porosity_0,
 								patch[0].soil_defaults[0][0].porosity_decay,
-								(patch[0].detention_store), time_int,
+								(patch[0].detention_store), vertical_int,
 								patch[0].soil_defaults[0][0].psi_air_entry);
 					} else {
 						infiltration = compute_infiltration(verbose_flag,
@@ -644,7 +684,7 @@ void compute_subsurface_routing(struct command_line_object *command_line,
 								patch[0].soil_defaults[0][0].mz_v,
 								patch[0].soil_defaults[0][0].porosity_0,
 								patch[0].soil_defaults[0][0].porosity_decay,
-								(patch[0].detention_store), time_int,
+								(patch[0].detention_store), vertical_int,
 								patch[0].soil_defaults[0][0].psi_air_entry);
 					}
 				else
@@ -817,7 +857,7 @@ void compute_subsurface_routing(struct command_line_object *command_line,
 							patch[0].rootzone.S,
 							patch[0].soil_defaults[0][0].mz_v,
 							patch[0].rootzone.depth,
-							patch[0].soil_defaults[0][0].Ksat_0 / n_timesteps
+							patch[0].soil_defaults[0][0].Ksat_0 / n_vertical
 									/ 2,
 							patch[0].rz_storage
 									- patch[0].rootzone.field_capacity);
@@ -833,7 +873,7 @@ void compute_subsurface_routing(struct command_line_object *command_line,
 							patch[0].soil_defaults[0][0].pore_size_index,
 							patch[0].S, patch[0].soil_defaults[0][0].mz_v,
 							patch[0].sat_deficit_z,
-							patch[0].soil_defaults[0][0].Ksat_0 / n_timesteps
+							patch[0].soil_defaults[0][0].Ksat_0 / n_vertical
 									/ 2,
 							patch[0].unsat_storage - patch[0].field_capacity);
 
@@ -851,7 +891,7 @@ void compute_subsurface_routing(struct command_line_object *command_line,
 							patch[0].soil_defaults[0][0].pore_size_index,
 							patch[0].S, patch[0].soil_defaults[0][0].mz_v,
 							patch[0].sat_deficit_z,
-							patch[0].soil_defaults[0][0].Ksat_0 / n_timesteps
+							patch[0].soil_defaults[0][0].Ksat_0 / n_vertical
 									/ 2,
 							patch[0].rz_storage
 									- patch[0].rootzone.field_capacity);
@@ -1154,6 +1194,9 @@ void compute_subsurface_routing(struct command_line_object *command_line,
 		} /* end i */
 
 	} /* end k  */
+	if ((active_flag == 1) && (verbose_flag > 1))
+		printf("\n basin %d routed %d of %d patch steps", basin[0].ID,
+				num_routed, n_timesteps * basin->route_list->num_patches);
 
 	basin_outflow /= basin_area;
 	preday_basin_rz_storage /= basin_area;
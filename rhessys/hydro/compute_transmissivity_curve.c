@@ -43,6 +43,7 @@
 #include <stdio.h>
 #include <math.h>
 #include "rhessys.h"
+#include "fast_math.h"
 #include "phys_constants.h"
 
 double 	*compute_transmissivity_curve( 
@@ -153,7 +154,7 @@ double 	*compute_transmissivity_curve(
 
 		if (m > ZERO)
 			transmissivity_layer = gamma  
-			 * (exp ( -1.0 * (max(depth, 0.0)/ m)) - exp ( -1.0 * (lower/m))); 
+			 * (EXP( -1.0 * (max(depth, 0.0)/ m)) - EXP( -1.0 * (lower/m))); 
 		else
 			transmissivity_layer =  gamma * (lower-depth);
 
@@ -176,7 +177,7 @@ double 	*compute_transmissivity_curve(
 		lower = patch[0].soil_defaults[0][0].soil_water_cap;
 		depth = 0;
 		if (m > ZERO)
-			transmissivity[initial-1] =   (exp ( -1.0 * (max(depth, 0.0)/ m)) - exp ( -1.0 * (lower/m))); 
+			transmissivity[initial-1] =   (EXP( -1.0 * (max(depth, 0.0)/ m)) - EXP( -1.0 * (lower/m))); 
 		else
 			transmissivity[initial-1] =  (lower-depth);
 		
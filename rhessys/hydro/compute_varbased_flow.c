@@ -9,8 +9,7 @@
 /*								*/
 /*	SYNOPSIS						*/
 /*	compute_varbased_flow(				*/
-/*				double	,			*/
-/*				double	,			*/
+/*				struct patch_object *,	*/
 /*				double	,			*/
 /*				double	,			*/
 /*				double	)			*/
@@ -19,11 +18,10 @@
 /*	estimate of subsurface flow from patch			*/
 /*								*/
 /*	OPTIONS							*/
+/*	patch - patch with a transmissivity_profile		*/
 /*	double	std - standard deviation of normal distrib	*/
+/*	double	s1 - (m) mean saturation deficit		*/
 /*	double gamma						*/
-/*	double	m - Ksat decay parameter			*/
-/*	double	z - (m) depth to the water table		*/
-/*	double  D - maximum depth				*/
 /*								*/
 /*	DESCRIPTION						*/
 /*								*/
@@ -34,6 +32,11 @@
 /*								*/
 /*	PROGRAMMER NOTES					*/
 /*								*/
+/*	With std > 0 the average over the distribution is	*/
+/*	interpolated from the patch's smoothed profile (see	*/
+/*	compute_smoothed_transmissivity) rather than summed	*/
+/*	over the quadrature on each call.			*/
+/*								*/
 /*--------------------------------------------------------------*/
 #include <stdio.h>
 #include <math.h>
@@ -41,12 +44,10 @@
 #include "phys_constants.h"
 
 double	compute_varbased_flow(
-				int num_soil_intervals,
+				struct patch_object *patch,
 				double std,
 				double s1,
-				double gamma,	
-				double interval_size,
-				double *transmissivity
+				double gamma
 					)
 {
 
@@ -54,45 +55,41 @@ double	compute_varbased_flow(
 	/*--------------------------------------------------------------*/
 	/*	Local sub	definition				*/
 	/*--------------------------------------------------------------*/
+	void	compute_smoothed_transmissivity(
+		struct patch_object *,
+		double);
 
 	/*--------------------------------------------------------------*/
 	/*	Local variable definition.				*/
 	/*--------------------------------------------------------------*/
-	double	flow, accum;
-	double	normal[9], perc[9];
-	int i;
+	double	flow, x;
+	double	*smoothed;
 	int didx;
 
-	normal[0] = 0;
-	normal[1] = 0.253;
-	normal[2] = 0.524;
-	normal[3] = 0.842;
-	normal[4] = 1.283;
-	normal[5] = -0.253;
-	normal[6] = -0.524;
-	normal[7] = -0.842;
-	normal[8] = -1.283;
-
-	perc[0] = 0.2;
-	for (i=1; i<9; i++)
-		perc[i] = 0.1;
-
-	
 	flow = 0.0;
 	if (s1 < 0.0) s1 = 0.0;	
 
 	if (std > ZERO) {
-	for (i=0; i <9; i++) {
-		didx = (int) lround((s1 + normal[i]*std)/interval_size);
-		if (didx > num_soil_intervals) didx = num_soil_intervals;
-		accum = transmissivity[didx];
-		flow += accum * perc[i];
-	}
+		/*--------------------------------------------------------------*/
+		/*	interpolate the smoothed profile, rebuilt if std changed	*/
+		/*--------------------------------------------------------------*/
+		if ( (patch[0].smoothed_transmissivity_profile == NULL)
+			|| (patch[0].smoothed_transmissivity_std != std) )
+			compute_smoothed_transmissivity(patch, std);
+		smoothed = patch[0].smoothed_transmissivity_profile;
+		x = s1/patch[0].soil_defaults[0][0].interval_size;
+		didx = (int) x;
+		if (didx >= patch[0].num_smoothed_intervals)
+			flow = smoothed[patch[0].num_smoothed_intervals];
+		else
+			flow = smoothed[didx]
+				+ (smoothed[didx+1] - smoothed[didx]) * (x - didx);
 	}
 	else  {
-		didx = (int) lround(s1/interval_size);
-		if (didx > num_soil_intervals) didx = num_soil_intervals;
-		flow = transmissivity[didx];
+		didx = (int) lround(s1/patch[0].soil_defaults[0][0].interval_size);
+		if (didx > patch[0].num_soil_intervals)
+			didx = patch[0].num_soil_intervals;
+		flow = patch[0].transmissivity_profile[didx];
 	}
 	flow = flow*gamma; 
 	return(flow);
@@ -74,7 +74,7 @@ double	compute_varbased_returnflow( double std,
 	normal[8] = -1.283;
 
 	perc[0] = 0.2;
-	for (i=1; i<8; i++)
+	for (i=1; i<9; i++)
 		perc[i] = 0.1;
 
 	return_flow = 0.0;
@@ -71,11 +71,16 @@
 /*								*/
 /*	PROGRAMMER NOTES					*/
 /*								*/
+/*	With -soiltable cases i and iii invert the profile	*/
+/*	table for p_0, p and soil_depth (soil_profile_table.c)	*/
+/*	where z_final is within the soil, the inverse of the	*/
+/*	series compute_delta_water then uses.			*/
 /*								*/
 /*--------------------------------------------------------------*/
 #include <stdio.h>
 #include <math.h>
 #include "rhessys.h"
+#include "fast_math.h"
 
 double	compute_z_final(
 						int	verbose_flag,
@@ -95,6 +100,16 @@ double	compute_z_final(
 		double,
 		double,
 		double);
+	struct	soil_profile_table	*find_soil_profile_table(
+		double,
+		double,
+		double);
+	double	soil_profile_storage(
+		struct soil_profile_table *,
+		double);
+	double	soil_profile_depth(
+		struct soil_profile_table *,
+		double);
 	
 	/*--------------------------------------------------------------*/
 	/*	Local variable definition.									*/
@@ -102,6 +117,8 @@ double	compute_z_final(
 	double	arguement;
 	double	delta_water_surf;
 	double	z_final;
+	double	storage;
+	struct	soil_profile_table	*table;
 	
 	/*--------------------------------------------------------------*/
 	/*	User defined function relating water table gain/loss    */
@@ -160,6 +177,7 @@ double	compute_z_final(
 	/*--------------------------------------------------------------*/
 	/*	Ensure that p and p_0 is not zero 			*/
 	/*--------------------------------------------------------------*/
+	table = find_soil_profile_table(p_0, p, soil_depth);
 	p = max(p,0.00000001);
 	p_0 = max(p_0,0.00000001);
 	
@@ -182,10 +200,14 @@ double	compute_z_final(
 			/*	Make sure we dont drain more than there is.		*/
 			/*--------------------------------------------------------------*/
 			delta_water = -1 * z_final;
-			if (p < 999.9) {
+			if ( (table != NULL)
+				&& (z_final <= table[0].storage[table[0].num_intervals]) ){
+				z_final = soil_profile_depth(table, z_final);
+			}
+			else if (p < 999.9) {
 				if ( z_final < (p*p_0) ){
 					z_final = -1 * p *
-						log( 1 +  delta_water / ( p * p_0) );
+						LOG( 1 +  delta_water / ( p * p_0) );
 				}
 				else {
 					z_final = soil_depth;
@@ -221,9 +243,17 @@ double	compute_z_final(
 			/*	make sure if delta_water is negative we dont blow up	*/
 			/*	the logarithm						*/
 			/*--------------------------------------------------------------*/
-			arguement = ( exp( -1 * z_initial/p) + delta_water / (p*p_0));
-			if ( arguement > 0 ){
-				z_final = -1 * p * log(arguement);
+			if ( (table != NULL) && (z_initial <= soil_depth) )
+				storage = soil_profile_storage(table, z_initial) - delta_water;
+			else
+				storage = -1.0;
+			if ( (storage >= 0.0)
+				&& (storage <= table[0].storage[table[0].num_intervals]) ){
+				z_final = soil_profile_depth(table, storage);
+			}
+			else if ( (arguement = EXP( -1 * z_initial/p)
+				+ delta_water / (p*p_0)) > 0 ){
+				z_final = -1 * p * LOG(arguement);
 			}
 			else{
 				z_final = soil_depth;
@@ -54,6 +54,7 @@
 #include <math.h>
 #include "phys_constants.h"
 #include "rhessys.h"
+#include "fast_math.h"
 
 double	penman_monteith(
 						int	verbose_flag,
@@ -117,8 +118,8 @@ double	penman_monteith(
 	/*--------------------------------------------------------------*/
 	/*	Saturation vapour pressures at t1 and t2(Pa)		*/
 	/*--------------------------------------------------------------*/
-	pvs1 = 610.7 * exp(17.38 * t1 / ( 239.0 + t1));
-	pvs2 = 610.7 * exp(17.38 * t2 / ( 239.0 + t2));
+	pvs1 = 610.7 * EXP(17.38 * t1 / ( 239.0 + t1));
+	pvs2 = 610.7 * EXP(17.38 * t2 / ( 239.0 + t2));
 	/*--------------------------------------------------------------*/
 	/*	Slope of pvs vs T curve at Tair		(Pa/deg C)	*/
 	/*--------------------------------------------------------------*/
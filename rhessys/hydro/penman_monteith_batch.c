@@ -0,0 +1,121 @@
+/*--------------------------------------------------------------*/
+/*								*/
+/*		penman_monteith_batch.c				*/
+/*								*/
+/*	penman_monteith_batch - Penman monteith E.T. equation	*/
+/*		for several surfaces under the same air		*/
+/*								*/
+/*	NAME							*/
+/*	penman_monteith_batch					*/
+/*								*/
+/*	SYNOPSIS						*/
+/*	void	penman_monteith_batch(				*/
+/*			int	verbose_flag,			*/
+/*			double	Tair,				*/
+/*			double	Pair,				*/
+/*			int	num_surfaces,			*/
+/*			double	*vpd,				*/
+/*			double	*Rnet,				*/
+/*			double	*rs,				*/
+/*			double	*ra,				*/
+/*			int	output_flag,			*/
+/*			double	*et)				*/
+/*								*/
+/*	OPTIONS							*/
+/*								*/
+/*	DESCRIPTION						*/
+/*								*/
+/*	Evaluates penman_monteith for num_surfaces sets of	*/
+/*	vpd, Rnet, rs and ra (units as for penman_monteith)	*/
+/*	that share the air temperature Tair and pressure Pair,	*/
+/*	returning each flux in et[] in the units of		*/
+/*	output_flag.  The air density, latent heat, slope of	*/
+/*	the saturation vapour pressure curve and psychrometric	*/
+/*	constant depend only on the air, so the two		*/
+/*	exponentials are taken once for the batch and the	*/
+/*	loop over surfaces is plain arithmetic.			*/
+/*								*/
+/*	Each et[i] is bitwise the same as the matching		*/
+/*	penman_monteith call.					*/
+/*								*/
+/*	PROGRAMMER NOTES					*/
+/*								*/
+/*	Callers in one stratum or patch all see the zone's	*/
+/*	tday and pa, so they collect their calls into one	*/
+/*	batch (canopy_stratum_daily_F, surface_daily_F).	*/
+/*								*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "phys_constants.h"
+#include "rhessys.h"
+#include "fast_math.h"
+
+void	penman_monteith_batch(
+						int	verbose_flag,
+						double	Tair,
+						double	Pair,
+						int	num_surfaces,
+						double	*vpd,
+						double	*Rnet,
+						double	*rs,
+						double	*ra,
+						int	output_flag,
+						double	*et)
+{
+	/*------------------------------------------------------*/
+	/*	Local Variable Definition. 							*/
+	/*------------------------------------------------------*/
+	int	i;
+	double	dt;
+	double	rho;
+	double	lhvap;
+	double	s;
+	double	t1;
+	double	t2;
+	double	pvs1;
+	double	pvs2;
+	double	gamma;
+	double	e;
+
+	if ( (output_flag < 0) || (output_flag > 2) ){
+		fprintf(stderr,"FATAL ERROR: in penman_monteith_batch - invalid output flag");
+		exit(EXIT_FAILURE);
+	}
+	/*--------------------------------------------------------------*/
+	/*	Air properties, as in penman_monteith			*/
+	/*--------------------------------------------------------------*/
+	rho = 1.292 - ( 0.00428 * Tair );
+	lhvap = 2.5023e6 - 2430.54 * Tair;
+	dt = 0.2;
+	t1 = Tair + dt;
+	t2 = Tair - dt;
+	pvs1 = 610.7 * EXP(17.38 * t1 / ( 239.0 + t1));
+	pvs2 = 610.7 * EXP(17.38 * t2 / ( 239.0 + t2));
+	s = ( pvs1 - pvs2 ) / ( t1 - t2 );
+	gamma = CP * Pair / ( lhvap );
+	/*--------------------------------------------------------------*/
+	/*	Evaporation in W/m2 for each surface, converted		*/
+	/*--------------------------------------------------------------*/
+	for (i=0; i < num_surfaces; i++){
+		e = ((s*Rnet[i]) + (rho*CP*vpd[i]/ra[i]))
+			/ (gamma*(1.0 + rs[i]/ra[i]) +s);
+		if ( output_flag == 0 )
+			et[i] = e / lhvap;
+		else if ( output_flag == 1 )
+			et[i] = e;
+		else
+			et[i] = e / ( lhvap * 1000 );
+	}
+	if ( verbose_flag > 2){
+		for (i=0; i < num_surfaces; i++){
+			printf("%8.4f %8.4f %8.4f %8.4f %8.1f %8.1f ",s , ra[i], rs[i],
+				Rnet[i],gamma,vpd[i]);
+			printf("%8.2f %8.4f ",Rnet[i], vpd[i]);
+			if ( output_flag == 2 )
+				printf("%8.4f", et[i] * lhvap * 1000 );
+		}
+	}
+	return;
+} /*end penman_monteith_batch*/
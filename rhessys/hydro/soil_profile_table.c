@@ -0,0 +1,223 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					soil_profile_table							*/
+/*																*/
+/*	soil_profile_table - tabulated exponential porosity			*/
+/*			profiles for compute_delta_water and				*/
+/*			compute_z_final (-soiltable)						*/
+/*																*/
+/*	NAME														*/
+/*	soil_profile_table - tabulated exponential porosity			*/
+/*			profiles (-soiltable)								*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	struct soil_profile_table *construct_soil_profile_table(	*/
+/*			double	n_0,										*/
+/*			double	p,											*/
+/*			double	soil_depth,									*/
+/*			int	intervals_per_decay)							*/
+/*	struct soil_profile_table *find_soil_profile_table(			*/
+/*			double	n_0,										*/
+/*			double	p,											*/
+/*			double	soil_depth)									*/
+/*	double	soil_profile_storage(								*/
+/*			struct	soil_profile_table	*table,					*/
+/*			double	z)											*/
+/*	double	soil_profile_depth(									*/
+/*			struct	soil_profile_table	*table,					*/
+/*			double	storage)									*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	For porosity n(z) = n_0 exp(-z/p) the pore volume above		*/
+/*	depth z is													*/
+/*																*/
+/*		S(z) = n_0 p (1 - exp(-z/p))							*/
+/*																*/
+/*	so compute_delta_water is S(z_initial) - S(z_final) and		*/
+/*	compute_z_final is the inverse of S.						*/
+/*																*/
+/*	construct_soil_profile_table (called by						*/
+/*	construct_soil_defaults) stores S and the pore volume		*/
+/*	below each depth, D(z) = n_0 p exp(-z/p), at knots			*/
+/*	dz = p/intervals_per_decay apart from 0 to soil_depth, and	*/
+/*	keeps the table in a list, or returns the table already	*/
+/*	made for the same n_0, p and soil_depth.  It makes no table	*/
+/*	(NULL) where porosity is taken as constant (p <= 0 or		*/
+/*	p >= 999) or the table would have more than					*/
+/*	MAX_SOIL_PROFILE_INTERVALS intervals.						*/
+/*																*/
+/*	find_soil_profile_table returns the table for n_0, p and	*/
+/*	soil_depth, or NULL if there is none, in which case the		*/
+/*	caller does the exact calculation.							*/
+/*																*/
+/*	Within an interval S(z_k + r) = S(z_k) + D(z_k) f(r/p),		*/
+/*	f(x) = 1 - exp(-x), and soil_profile_storage sums f to		*/
+/*	x^7; soil_profile_depth inverts it with						*/
+/*	-log(1 - q) = 2 atanh(q/(2-q)) summed to the 9th power,		*/
+/*	for 0 <= storage <= S(soil_depth).							*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*	With h = dz/p the storage error is at most h^8/8! of		*/
+/*	D(z_k) and the depth error 2 s^11 / (11 (1 - s^2)) of p,	*/
+/*	s = tanh(h/2): 6e-15 and 5e-18 for the default 16			*/
+/*	intervals per porosity_decay, 6e-10 and 2e-11 for 4, and	*/
+/*	2.5e-5 and 5e-5 for 1.  The bound does not depend on		*/
+/*	soil_depth.  The depth search starts from a bucket on an	*/
+/*	even storage grid and bisects within it, so it stays		*/
+/*	short even where deep porosity is very small.				*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "rhessys.h"
+
+#define	MAX_SOIL_PROFILE_INTERVALS	1048576
+
+static	struct	soil_profile_table	*soil_profile_tables = NULL;
+static	struct	soil_profile_table	*last_soil_profile_table = NULL;
+
+struct soil_profile_table *find_soil_profile_table(
+						double	n_0,
+						double	p,
+						double	soil_depth)
+{
+	struct	soil_profile_table	*table;
+
+	if (soil_profile_tables == NULL)
+		return(NULL);
+	table = last_soil_profile_table;
+	if ( (table != NULL) && (table[0].n_0 == n_0) && (table[0].p == p)
+		&& (table[0].soil_depth == soil_depth) )
+		return(table);
+	for (table=soil_profile_tables; table != NULL; table=table[0].next)
+		if ( (table[0].n_0 == n_0) && (table[0].p == p)
+			&& (table[0].soil_depth == soil_depth) ){
+			last_soil_profile_table = table;
+			return(table);
+		}
+	return(NULL);
+}
+
+/*--------------------------------------------------------------*/
+/*	1 - exp(-x) for 0 <= x <= h, and its inverse -log(1 - q)	*/
+/*--------------------------------------------------------------*/
+static	double	soil_profile_fraction(double x)
+{
+	return( x * (1.0 - x/2.0 * (1.0 - x/3.0 * (1.0 - x/4.0
+		* (1.0 - x/5.0 * (1.0 - x/6.0 * (1.0 - x/7.0)))))) );
+}
+
+static	double	soil_profile_decay_depth(double q)
+{
+	double	s, s2;
+
+	s = q / (2.0 - q);
+	s2 = s * s;
+	return( 2.0 * s * (1.0 + s2 * (1.0/3.0 + s2 * (1.0/5.0
+		+ s2 * (1.0/7.0 + s2 * (1.0/9.0))))) );
+}
+
+struct soil_profile_table *construct_soil_profile_table(
+						double	n_0,
+						double	p,
+						double	soil_depth,
+						int	intervals_per_decay)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local function definition.									*/
+	/*--------------------------------------------------------------*/
+	void	*alloc( size_t, char *, char * );
+
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	int	j, k, num_intervals;
+	struct	soil_profile_table	*table;
+
+	if ( (p <= 0.0) || (p >= 999.0) || (soil_depth <= 0.0)
+		|| (n_0 <= 0.0) || (intervals_per_decay < 1)
+		|| (soil_depth / p * intervals_per_decay
+		> MAX_SOIL_PROFILE_INTERVALS) )
+		return(NULL);
+	if ( (table = find_soil_profile_table(n_0, p, soil_depth)) != NULL )
+		return(table);
+	table = (struct soil_profile_table *)
+		alloc(sizeof(struct soil_profile_table),
+		"soil_profile_table","construct_soil_profile_table");
+	table[0].n_0 = n_0;
+	table[0].p = p;
+	table[0].soil_depth = soil_depth;
+	num_intervals = (int) ceil(soil_depth / p * intervals_per_decay);
+	table[0].num_intervals = num_intervals;
+	table[0].dz = soil_depth / num_intervals;
+	table[0].storage = (double *) alloc((num_intervals + 1) * sizeof(double),
+		"storage","construct_soil_profile_table");
+	table[0].below = (double *) alloc((num_intervals + 1) * sizeof(double),
+		"below","construct_soil_profile_table");
+	for (k=0; k <= num_intervals; k++){
+		table[0].storage[k] = -1.0 * n_0 * p * expm1(-k * table[0].dz / p);
+		table[0].below[k] = n_0 * p * exp(-k * table[0].dz / p);
+	}
+	/*--------------------------------------------------------------*/
+	/*	buckets on an even storage grid for soil_profile_depth		*/
+	/*--------------------------------------------------------------*/
+	table[0].dS_inv = num_intervals / table[0].storage[num_intervals];
+	table[0].bucket = (int *) alloc((num_intervals + 1) * sizeof(int),
+		"bucket","construct_soil_profile_table");
+	k = 0;
+	for (j=0; j <= num_intervals; j++){
+		while ( (k < num_intervals - 1)
+			&& (table[0].storage[k+1] * table[0].dS_inv <= j) )
+			k++;
+		table[0].bucket[j] = k;
+	}
+	table[0].next = soil_profile_tables;
+	soil_profile_tables = table;
+	return(table);
+}
+
+double	soil_profile_storage(
+						struct	soil_profile_table	*table,
+						double	z)
+{
+	int	k;
+	double	x;
+
+	x = z / table[0].dz;
+	k = (int) x;
+	if (k >= table[0].num_intervals)
+		k = table[0].num_intervals - 1;
+	return( table[0].storage[k] + table[0].below[k]
+		* soil_profile_fraction((z - k * table[0].dz) / table[0].p) );
+}
+
+double	soil_profile_depth(
+						struct	soil_profile_table	*table,
+						double	storage)
+{
+	int	j, k, lo, hi;
+
+	j = (int) (storage * table[0].dS_inv);
+	if (j >= table[0].num_intervals)
+		j = table[0].num_intervals - 1;
+	/*--------------------------------------------------------------*/
+	/*	the interval holding storage lies between the buckets		*/
+	/*--------------------------------------------------------------*/
+	lo = table[0].bucket[j];
+	hi = table[0].bucket[j+1];
+	while (lo < hi){
+		k = (lo + hi + 1) / 2;
+		if (table[0].storage[k] <= storage)
+			lo = k;
+		else
+			hi = k - 1;
+	}
+	k = lo;
+	return( k * table[0].dz + table[0].p * soil_profile_decay_depth(
+		(storage - table[0].storage[k]) / table[0].below[k]) );
+}
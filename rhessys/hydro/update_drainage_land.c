@@ -59,24 +59,15 @@ void  update_drainage_land(
 
 
 	double compute_varbased_flow(
-		int,
-		double,
-		double,
+		struct patch_object *,
 		double,
 		double,
-		double *);
+		double);
 
 
-	double compute_N_leached(int,
-		double,
-		double,
-		double,
-		double,
-		double,
-		double,
-		double,
-		double,
-		double,
+	void	compute_solutes_leached(int,
+		struct soil_default *,
+		double *,
 		double,
 		double,
 		double,
@@ -104,7 +95,7 @@ void  update_drainage_land(
 	/*--------------------------------------------------------------*/
 	int j, d, idx;
 	double tmp;
-	double m, Ksat, std_scale;
+	double std_scale;
 	double NH4_leached_to_patch, NH4_leached_to_stream;
 	double NO3_leached_to_patch, NO3_leached_to_stream;
 	double DON_leached_to_patch, DON_leached_to_stream;
@@ -123,6 +114,7 @@ void  update_drainage_land(
 	double innundation_depth, infiltration; /* m */
 	double total_gamma;
 	double Nin, Nout; /* kg/m2 */ 
+	double total[NUM_LEACH_SOLUTES], leached[NUM_LEACH_SOLUTES]; /* kg/m2 */
 	double t1,t2,t3;
 
 	struct patch_object *neigh;
@@ -143,12 +135,6 @@ void  update_drainage_land(
 	DOC_leached_to_surface = 0.0;
 	DON_leached_to_surface = 0.0;
 
-	/*--------------------------------------------------------------*/
-	/*	m and K are multiplied by sensitivity analysis variables */
-	/*--------------------------------------------------------------*/
-
-	m = patch[0].m ;
-	Ksat = patch[0].soil_defaults[0][0].Ksat_0 ;
 	d=0;
 
 	/*--------------------------------------------------------------*/
@@ -169,12 +155,10 @@ void  update_drainage_land(
 	std_scale = command_line[0].std_scale;
 
 	route_to_patch =  time_int * compute_varbased_flow(
-		patch[0].num_soil_intervals,
-		patch[0].std * std_scale, 
+		patch,
+		patch[0].std * std_scale,
 		patch[0].sat_deficit,
-		total_gamma, 
-		patch[0].soil_defaults[0][0].interval_size,
-		patch[0].transmissivity_profile);
+		total_gamma);
 
 	if (route_to_patch < 0.0) route_to_patch = 0.0;
 	if ( route_to_patch > available_sat_water) 
@@ -183,80 +167,26 @@ void  update_drainage_land(
 	/* compute Nitrogen leaching amount				*/
 	/*--------------------------------------------------------------*/
 	if (command_line[0].grow_flag > 0) {
-		Nout = compute_N_leached(
-			verbose_flag,
-			patch[0].soil_ns.nitrate,
-			route_to_patch / patch[0].area,
-			patch[0].sat_deficit,
-			patch[0].soil_defaults[0][0].soil_water_cap,
-			m,
-			total_gamma / patch[0].area * time_int,
-			patch[0].soil_defaults[0][0].porosity_0,
-			patch[0].soil_defaults[0][0].porosity_decay,
-			patch[0].soil_defaults[0][0].N_decay_rate,
-			patch[0].soil_defaults[0][0].active_zone_z,
-			patch[0].soil_defaults[0][0].soil_depth,
-			patch[0].soil_defaults[0][0].NO3_adsorption_rate,
-			patch[0].transmissivity_profile);
-		NO3_leached_to_patch = Nout * patch[0].area;
-		patch[0].soil_ns.NO3_Qout += Nout;
-
-
-		Nout = compute_N_leached(
+		total[LEACH_NO3] = patch[0].soil_ns.nitrate;
+		total[LEACH_NH4] = patch[0].soil_ns.sminn;
+		total[LEACH_DON] = patch[0].soil_ns.DON;
+		total[LEACH_DOC] = patch[0].soil_cs.DOC;
+		compute_solutes_leached(
 			verbose_flag,
-			patch[0].soil_ns.sminn,
+			patch[0].soil_defaults[0],
+			total,
 			route_to_patch / patch[0].area,
 			patch[0].sat_deficit,
 			patch[0].soil_defaults[0][0].soil_water_cap,
-			m,
-			total_gamma / patch[0].area * time_int,
-			patch[0].soil_defaults[0][0].porosity_0,
-			patch[0].soil_defaults[0][0].porosity_decay,
-			patch[0].soil_defaults[0][0].N_decay_rate,
-			patch[0].soil_defaults[0][0].active_zone_z,
-			patch[0].soil_defaults[0][0].soil_depth,
-			patch[0].soil_defaults[0][0].NH4_adsorption_rate,
-			patch[0].transmissivity_profile);
-		NH4_leached_to_patch = Nout * patch[0].area;
-		patch[0].soil_ns.NH4_Qout += Nout;
-
-		Nout = compute_N_leached(
-			verbose_flag,
-			patch[0].soil_ns.DON,
-			route_to_patch / patch[0].area,
-			patch[0].sat_deficit,
-			patch[0].soil_defaults[0][0].soil_water_cap,
-			m,
-			total_gamma / patch[0].area * time_int,
-			patch[0].soil_defaults[0][0].porosity_0,
-			patch[0].soil_defaults[0][0].porosity_decay,
-			patch[0].soil_defaults[0][0].DOM_decay_rate,
-			patch[0].soil_defaults[0][0].active_zone_z,
-			patch[0].soil_defaults[0][0].soil_depth,
-			patch[0].soil_defaults[0][0].DON_adsorption_rate,
-			patch[0].transmissivity_profile);
-		DON_leached_to_patch = Nout * patch[0].area;
-		patch[0].soil_ns.DON_Qout += Nout;
-
-		Nout = compute_N_leached(
-			verbose_flag,
-			patch[0].soil_cs.DOC,
-			route_to_patch / patch[0].area,
-			patch[0].sat_deficit,
-			patch[0].soil_defaults[0][0].soil_water_cap,
-			m,
-			total_gamma / patch[0].area * time_int,
-			patch[0].soil_defaults[0][0].porosity_0,
-			patch[0].soil_defaults[0][0].porosity_decay,
-			patch[0].soil_defaults[0][0].DOM_decay_rate,
-			patch[0].soil_defaults[0][0].active_zone_z,
-			patch[0].soil_defaults[0][0].soil_depth,
-			patch[0].soil_defaults[0][0].DOC_adsorption_rate,
-			patch[0].transmissivity_profile);
-		DOC_leached_to_patch = Nout * patch[0].area;
-		patch[0].soil_cs.DOC_Qout += Nout;
-
-
+			leached);
+		NO3_leached_to_patch = leached[LEACH_NO3] * patch[0].area;
+		patch[0].soil_ns.NO3_Qout += leached[LEACH_NO3];
+		NH4_leached_to_patch = leached[LEACH_NH4] * patch[0].area;
+		patch[0].soil_ns.NH4_Qout += leached[LEACH_NH4];
+		DON_leached_to_patch = leached[LEACH_DON] * patch[0].area;
+		patch[0].soil_ns.DON_Qout += leached[LEACH_DON];
+		DOC_leached_to_patch = leached[LEACH_DOC] * patch[0].area;
+		patch[0].soil_cs.DOC_Qout += leached[LEACH_DOC];
 	}
 
 	
@@ -290,78 +220,26 @@ void  update_drainage_land(
 	/*	lost in subsurface flow routing				*/
 	/*--------------------------------------------------------------*/
 		if (command_line[0].grow_flag > 0) {
-			Nout = compute_N_leached(
-				verbose_flag,
-				patch[0].soil_ns.nitrate - (NO3_leached_to_patch/patch[0].area),
-				return_flow,
-				0.0,
-				0.0,
-				m,
-				total_gamma / patch[0].area * time_int,
-				patch[0].soil_defaults[0][0].porosity_0,
-				patch[0].soil_defaults[0][0].porosity_decay,
-				patch[0].soil_defaults[0][0].N_decay_rate,
-				patch[0].soil_defaults[0][0].active_zone_z,
-				patch[0].soil_defaults[0][0].soil_depth,
-				patch[0].soil_defaults[0][0].NO3_adsorption_rate,
-				patch[0].transmissivity_profile);
-			patch[0].surface_NO3 += Nout;
-			patch[0].soil_ns.NO3_Qout += Nout;
-
-			Nout = compute_N_leached(
-				verbose_flag,
-				patch[0].soil_ns.sminn - (NH4_leached_to_patch/patch[0].area),
-				return_flow,
-				0.0,
-				0.0,
-				m,
-				total_gamma / patch[0].area * time_int,
-				patch[0].soil_defaults[0][0].porosity_0,
-				patch[0].soil_defaults[0][0].porosity_decay,
-				patch[0].soil_defaults[0][0].N_decay_rate,
-				patch[0].soil_defaults[0][0].active_zone_z,
-				patch[0].soil_defaults[0][0].soil_depth,
-				patch[0].soil_defaults[0][0].NH4_adsorption_rate,
-				patch[0].transmissivity_profile);
-			patch[0].surface_NH4 += Nout;
-			patch[0].soil_ns.NH4_Qout += Nout;
-
-
-			Nout = compute_N_leached(
-				verbose_flag,
-				patch[0].soil_ns.DON - (DON_leached_to_patch/patch[0].area),
-				return_flow,
-				0.0,
-				0.0,
-				m,
-				total_gamma / patch[0].area * time_int,
-				patch[0].soil_defaults[0][0].porosity_0,
-				patch[0].soil_defaults[0][0].porosity_decay,
-				patch[0].soil_defaults[0][0].DOM_decay_rate,
-				patch[0].soil_defaults[0][0].active_zone_z,
-				patch[0].soil_defaults[0][0].soil_depth,
-				patch[0].soil_defaults[0][0].DON_adsorption_rate,
-				patch[0].transmissivity_profile);
-			patch[0].surface_DON += Nout;
-			patch[0].soil_ns.DON_Qout += Nout;
-
-			Nout = compute_N_leached(
+			total[LEACH_NO3] = patch[0].soil_ns.nitrate - (NO3_leached_to_patch/patch[0].area);
+			total[LEACH_NH4] = patch[0].soil_ns.sminn - (NH4_leached_to_patch/patch[0].area);
+			total[LEACH_DON] = patch[0].soil_ns.DON - (DON_leached_to_patch/patch[0].area);
+			total[LEACH_DOC] = patch[0].soil_cs.DOC - (DOC_leached_to_patch/patch[0].area);
+			compute_solutes_leached(
 				verbose_flag,
-				patch[0].soil_cs.DOC - (DOC_leached_to_patch/patch[0].area),
+				patch[0].soil_defaults[0],
+				total,
 				return_flow,
 				0.0,
 				0.0,
-				m,
-				total_gamma / patch[0].area * time_int,
-				patch[0].soil_defaults[0][0].porosity_0,
-				patch[0].soil_defaults[0][0].porosity_decay,
-				patch[0].soil_defaults[0][0].DOM_decay_rate,
-				patch[0].soil_defaults[0][0].active_zone_z,
-				patch[0].soil_defaults[0][0].soil_depth,
-				patch[0].soil_defaults[0][0].DOC_adsorption_rate,
-				patch[0].transmissivity_profile);
-			patch[0].surface_DOC += Nout;
-			patch[0].soil_cs.DOC_Qout += Nout;
+				leached);
+			patch[0].surface_NO3 += leached[LEACH_NO3];
+			patch[0].soil_ns.NO3_Qout += leached[LEACH_NO3];
+			patch[0].surface_NH4 += leached[LEACH_NH4];
+			patch[0].soil_ns.NH4_Qout += leached[LEACH_NH4];
+			patch[0].surface_DON += leached[LEACH_DON];
+			patch[0].soil_ns.DON_Qout += leached[LEACH_DON];
+			patch[0].surface_DOC += leached[LEACH_DOC];
+			patch[0].soil_cs.DOC_Qout += leached[LEACH_DOC];
 		}
 	
 	/*--------------------------------------------------------------*/
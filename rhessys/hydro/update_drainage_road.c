@@ -53,27 +53,19 @@ void  update_drainage_road(
 		double);
 
 
-	double compute_N_leached(int,
+	void	compute_solutes_leached(int,
+		struct soil_default *,
+		double *,
 		double,
 		double,
 		double,
-		double,
-		double,
-		double,
-		double,
-		double,
-		double,
-		double,
-		double,
-		double, double *);
+		double *);
 	
 	double compute_varbased_flow(
-		int,
-		double,
-		double,
+		struct patch_object *,
 		double,
 		double,
-		double *);
+		double);
 
 	double recompute_gamma(	
 		struct patch_object *,
@@ -90,7 +82,7 @@ void  update_drainage_road(
 	/*	Local variable definition.				*/
 	/*--------------------------------------------------------------*/
 	int i, j,k,d;
-	double m, Ksat, return_flow;
+	double return_flow;
 	double NO3_leached_to_patch, NO3_leached_to_stream, NO3_surface_leached_to_stream; /* kg/m2 */
 	double NH4_leached_to_patch, NH4_leached_to_stream, NH4_surface_leached_to_stream; /* kg/m2 */
 	double N_leached_total; /* kg/m2 */
@@ -105,6 +97,7 @@ void  update_drainage_road(
 	double  Qin, Qout, Qstr_total;  /* m */
 	double total_gamma, percent_loss;
 	double Nin, Nout; /* kg/m2 */ 
+	double total[NUM_LEACH_SOLUTES], leached[NUM_LEACH_SOLUTES]; /* kg/m2 */
 	double percent_tobe_routed;
 
 	struct patch_object *neigh;
@@ -126,11 +119,6 @@ void  update_drainage_road(
 	return_flow=0.0;
 
 
-	/*--------------------------------------------------------------*/
-	/*	m and K are multiplied by sensitivity analysis variables */
-	/*--------------------------------------------------------------*/
-	m = patch[0].m  ;
-	Ksat = patch[0].soil_defaults[0][0].Ksat_0 ;
 	d=0;
 	/*--------------------------------------------------------------*/
 	/*	recalculate gamma based on current saturation deficits  */
@@ -162,23 +150,19 @@ void  update_drainage_road(
 	/*	calculate amuount of water output to patches			*/
 	/*-----------------------------------------------------------*/
 		route_to_patch =  time_int * compute_varbased_flow(
-			patch[0].num_soil_intervals,
-			patch[0].std * command_line[0].std_scale, 
+			patch,
+			patch[0].std * command_line[0].std_scale,
 			road_int_depth,
-			total_gamma, 
-			patch[0].soil_defaults[0][0].interval_size,
-			patch[0].transmissivity_profile);
+			total_gamma);
 
 		/*-----------------------------------------------------------*/
 		/*	calculate amuount of water output to stream		*/
 		/*-----------------------------------------------------------*/
 		route_to_stream =  time_int * compute_varbased_flow(
-			patch[0].num_soil_intervals,
-			patch[0].std * command_line[0].std_scale, 
+			patch,
+			patch[0].std * command_line[0].std_scale,
 			patch[0].sat_deficit,
-			total_gamma, 
-			patch[0].soil_defaults[0][0].interval_size,
-			patch[0].transmissivity_profile) - route_to_patch;
+			total_gamma) - route_to_patch;
 
 		if (route_to_patch < 0.0) route_to_patch = 0.0;
 		if (route_to_stream < 0.0) route_to_stream = 0.0;
@@ -190,147 +174,46 @@ void  update_drainage_road(
 		/* compute Nitrogen leaching amount				*/
 		/*--------------------------------------------------------------*/
 		if (command_line[0].grow_flag > 0) {
-			NO3_leached_to_patch = compute_N_leached(
+			total[LEACH_NO3] = patch[0].soil_ns.nitrate;
+			total[LEACH_NH4] = patch[0].soil_ns.sminn;
+			total[LEACH_DON] = patch[0].soil_ns.DON;
+			total[LEACH_DOC] = patch[0].soil_cs.DOC;
+			compute_solutes_leached(
 				verbose_flag,
-				patch[0].soil_ns.nitrate,
+				patch[0].soil_defaults[0],
+				total,
 				route_to_patch / patch[0].area,
 				road_int_depth,
 				patch[0].soil_defaults[0][0].soil_water_cap,
-				m,
-				total_gamma / patch[0].area * time_int,
-				patch[0].soil_defaults[0][0].porosity_0,
-				patch[0].soil_defaults[0][0].porosity_decay,
-				patch[0].soil_defaults[0][0].N_decay_rate,
-				patch[0].soil_defaults[0][0].active_zone_z,
-				patch[0].soil_defaults[0][0].soil_depth,
-				patch[0].soil_defaults[0][0].NO3_adsorption_rate,
-				patch[0].transmissivity_profile);
-			NO3_leached_to_stream = compute_N_leached(
+				leached);
+			NO3_leached_to_patch = leached[LEACH_NO3];
+			NH4_leached_to_patch = leached[LEACH_NH4];
+			DON_leached_to_patch = leached[LEACH_DON];
+			DOC_leached_to_patch = leached[LEACH_DOC];
+			/*--------------------------------------------------------------*/
+			/*	NH4 to the stream is taken from the nitrate pool	*/
+			/*--------------------------------------------------------------*/
+			total[LEACH_NH4] = patch[0].soil_ns.nitrate;
+			compute_solutes_leached(
 				verbose_flag,
-				patch[0].soil_ns.nitrate,
+				patch[0].soil_defaults[0],
+				total,
 				route_to_stream / patch[0].area,
 				patch[0].sat_deficit,
 				patch[0].soil_defaults[0][0].soil_water_cap,
-				m,
-				total_gamma / patch[0].area * time_int,
-				patch[0].soil_defaults[0][0].porosity_0,
-				patch[0].soil_defaults[0][0].porosity_decay,
-				patch[0].soil_defaults[0][0].N_decay_rate,
-				patch[0].soil_defaults[0][0].active_zone_z,
-				patch[0].soil_defaults[0][0].soil_depth,
-				patch[0].soil_defaults[0][0].NO3_adsorption_rate,
-				patch[0].transmissivity_profile) -
-				NO3_leached_to_patch;
+				leached);
+			NO3_leached_to_stream = leached[LEACH_NO3] - NO3_leached_to_patch;
 			if (NO3_leached_to_stream < 0.0) NO3_leached_to_stream = 0.0;
 			patch[0].soil_ns.NO3_Qout += (NO3_leached_to_patch + NO3_leached_to_stream);
-
-			NH4_leached_to_patch = compute_N_leached(
-				verbose_flag,
-				patch[0].soil_ns.sminn,
-				route_to_patch / patch[0].area,
-				road_int_depth,
-				patch[0].soil_defaults[0][0].soil_water_cap,
-				m,
-				total_gamma / patch[0].area * time_int,
-				patch[0].soil_defaults[0][0].porosity_0,
-				patch[0].soil_defaults[0][0].porosity_decay,
-				patch[0].soil_defaults[0][0].N_decay_rate,
-				patch[0].soil_defaults[0][0].active_zone_z,
-				patch[0].soil_defaults[0][0].soil_depth,
-				patch[0].soil_defaults[0][0].NH4_adsorption_rate,
-				patch[0].transmissivity_profile);
-			NH4_leached_to_stream = compute_N_leached(
-				verbose_flag,
-				patch[0].soil_ns.nitrate,
-				route_to_stream / patch[0].area,
-				patch[0].sat_deficit,
-				patch[0].soil_defaults[0][0].soil_water_cap,
-				m,
-				total_gamma / patch[0].area * time_int,
-				patch[0].soil_defaults[0][0].porosity_0,
-				patch[0].soil_defaults[0][0].porosity_decay,
-				patch[0].soil_defaults[0][0].N_decay_rate,
-				patch[0].soil_defaults[0][0].active_zone_z,
-				patch[0].soil_defaults[0][0].soil_depth,
-				patch[0].soil_defaults[0][0].NH4_adsorption_rate,
-				patch[0].transmissivity_profile) -
-				NH4_leached_to_patch;
+			NH4_leached_to_stream = leached[LEACH_NH4] - NH4_leached_to_patch;
 			if (NH4_leached_to_stream < 0.0) NH4_leached_to_stream = 0.0;
 			patch[0].soil_ns.NH4_Qout += (NH4_leached_to_patch + NH4_leached_to_stream);
-
-
-			DON_leached_to_patch = compute_N_leached(
-				verbose_flag,
-				patch[0].soil_ns.DON,
-				route_to_patch / patch[0].area,
-				road_int_depth,
-				patch[0].soil_defaults[0][0].soil_water_cap,
-				m,
-				total_gamma / patch[0].area * time_int,
-				patch[0].soil_defaults[0][0].porosity_0,
-				patch[0].soil_defaults[0][0].porosity_decay,
-				patch[0].soil_defaults[0][0].DOM_decay_rate,
-				patch[0].soil_defaults[0][0].active_zone_z,
-				patch[0].soil_defaults[0][0].soil_depth,
-				patch[0].soil_defaults[0][0].DON_adsorption_rate,
-				patch[0].transmissivity_profile);
-			DON_leached_to_stream = compute_N_leached(
-				verbose_flag,
-				patch[0].soil_ns.DON,
-				route_to_stream / patch[0].area,
-				patch[0].sat_deficit,
-				patch[0].soil_defaults[0][0].soil_water_cap,
-				m,
-				total_gamma / patch[0].area * time_int,
-				patch[0].soil_defaults[0][0].porosity_0,
-				patch[0].soil_defaults[0][0].porosity_decay,
-				patch[0].soil_defaults[0][0].DOM_decay_rate,
-				patch[0].soil_defaults[0][0].active_zone_z,
-				patch[0].soil_defaults[0][0].soil_depth,
-				patch[0].soil_defaults[0][0].DON_adsorption_rate,
-				patch[0].transmissivity_profile) -
-				DON_leached_to_patch;
-                     if (DON_leached_to_stream < 0.0) DON_leached_to_stream = 0.0;
-
+			DON_leached_to_stream = leached[LEACH_DON] - DON_leached_to_patch;
+			if (DON_leached_to_stream < 0.0) DON_leached_to_stream = 0.0;
 			patch[0].soil_ns.DON_Qout += (DON_leached_to_patch + DON_leached_to_stream);
-
-
-			DOC_leached_to_patch = compute_N_leached(
-				verbose_flag,
-				patch[0].soil_cs.DOC,
-				route_to_patch / patch[0].area,
-				road_int_depth,
-				patch[0].soil_defaults[0][0].soil_water_cap,
-				m,
-				total_gamma / patch[0].area * time_int,
-				patch[0].soil_defaults[0][0].porosity_0,
-				patch[0].soil_defaults[0][0].porosity_decay,
-				patch[0].soil_defaults[0][0].DOM_decay_rate,
-				patch[0].soil_defaults[0][0].active_zone_z,
-				patch[0].soil_defaults[0][0].soil_depth,
-				patch[0].soil_defaults[0][0].DOC_adsorption_rate,
-				patch[0].transmissivity_profile);
-			DOC_leached_to_stream = compute_N_leached(
-				verbose_flag,
-				patch[0].soil_cs.DOC,
-				route_to_stream / patch[0].area,
-				patch[0].sat_deficit,
-				patch[0].soil_defaults[0][0].soil_water_cap,
-				m,
-				total_gamma / patch[0].area * time_int,
-				patch[0].soil_defaults[0][0].porosity_0,
-				patch[0].soil_defaults[0][0].porosity_decay,
-				patch[0].soil_defaults[0][0].DOM_decay_rate,
-				patch[0].soil_defaults[0][0].active_zone_z,
-				patch[0].soil_defaults[0][0].soil_depth,
-				patch[0].soil_defaults[0][0].DOC_adsorption_rate,
-				patch[0].transmissivity_profile) -
-				DOC_leached_to_patch;
-
+			DOC_leached_to_stream = leached[LEACH_DOC] - DOC_leached_to_patch;
 			if (DOC_leached_to_stream < 0.0) DOC_leached_to_stream = 0.0;
-		      
 			patch[0].soil_cs.DOC_Qout += (DOC_leached_to_patch + DOC_leached_to_stream);
-					 
 		}
 		patch[0].Qout += ((route_to_patch + route_to_stream) / patch[0].area);
 
@@ -342,12 +225,10 @@ void  update_drainage_road(
 	else {
 		route_to_stream = 0.0;
 		route_to_patch =  time_int * compute_varbased_flow(
-			patch[0].num_soil_intervals,
-			patch[0].std * command_line[0].std_scale, 
+			patch,
+			patch[0].std * command_line[0].std_scale,
 			patch[0].sat_deficit,
-			total_gamma, 
-			patch[0].soil_defaults[0][0].interval_size,
-			patch[0].transmissivity_profile);
+			total_gamma);
 
 		if (route_to_patch < 0.0) route_to_patch = 0.0;
 		if (route_to_patch > available_sat_water) 
@@ -356,81 +237,30 @@ void  update_drainage_road(
 	/* compute Nitrogen leaching amount				*/
 	/*--------------------------------------------------------------*/
 		if (command_line[0].grow_flag > 0) {
-			NO3_leached_to_patch = compute_N_leached(
+			total[LEACH_NO3] = patch[0].soil_ns.nitrate;
+			total[LEACH_NH4] = patch[0].soil_ns.sminn;
+			total[LEACH_DON] = patch[0].soil_ns.DON;
+			total[LEACH_DOC] = patch[0].soil_cs.DOC;
+			compute_solutes_leached(
 				verbose_flag,
-				patch[0].soil_ns.nitrate,
+				patch[0].soil_defaults[0],
+				total,
 				route_to_patch / patch[0].area,
 				patch[0].sat_deficit,
 				patch[0].soil_defaults[0][0].soil_water_cap,
-				m,
-				total_gamma / patch[0].area * time_int,
-				patch[0].soil_defaults[0][0].porosity_0,
-				patch[0].soil_defaults[0][0].porosity_decay,
-				patch[0].soil_defaults[0][0].N_decay_rate,
-				patch[0].soil_defaults[0][0].active_zone_z,
-				patch[0].soil_defaults[0][0].soil_depth,
-				patch[0].soil_defaults[0][0].NO3_adsorption_rate,
-				patch[0].transmissivity_profile);
+				leached);
+			NO3_leached_to_patch = leached[LEACH_NO3];
 			NO3_leached_to_stream = 0.0;
 			patch[0].soil_ns.NO3_Qout += (NO3_leached_to_patch + NO3_leached_to_stream);
-
-
-			NH4_leached_to_patch = compute_N_leached(
-				verbose_flag,
-				patch[0].soil_ns.sminn,
-				route_to_patch / patch[0].area,
-				patch[0].sat_deficit,
-				patch[0].soil_defaults[0][0].soil_water_cap,
-				m,
-				total_gamma / patch[0].area * time_int,
-				patch[0].soil_defaults[0][0].porosity_0,
-				patch[0].soil_defaults[0][0].porosity_decay,
-				patch[0].soil_defaults[0][0].N_decay_rate,
-				patch[0].soil_defaults[0][0].active_zone_z,
-				patch[0].soil_defaults[0][0].soil_depth,
-				patch[0].soil_defaults[0][0].NH4_adsorption_rate,
-				patch[0].transmissivity_profile);
+			NH4_leached_to_patch = leached[LEACH_NH4];
 			NH4_leached_to_stream = 0.0;
 			patch[0].soil_ns.NH4_Qout += (NH4_leached_to_patch + NH4_leached_to_stream);
-
-
-			DON_leached_to_patch = compute_N_leached(
-				verbose_flag,
-				patch[0].soil_ns.DON,
-				route_to_patch / patch[0].area,
-				patch[0].sat_deficit,
-				patch[0].soil_defaults[0][0].soil_water_cap,
-				m,
-				total_gamma / patch[0].area * time_int,
-				patch[0].soil_defaults[0][0].porosity_0,
-				patch[0].soil_defaults[0][0].porosity_decay,
-				patch[0].soil_defaults[0][0].DOM_decay_rate,
-				patch[0].soil_defaults[0][0].active_zone_z,
-				patch[0].soil_defaults[0][0].soil_depth,
-				patch[0].soil_defaults[0][0].DON_adsorption_rate,
-				patch[0].transmissivity_profile);
+			DON_leached_to_patch = leached[LEACH_DON];
 			DON_leached_to_stream = 0.0;
 			patch[0].soil_ns.DON_Qout += (DON_leached_to_patch + DON_leached_to_stream);
-
-
-			DOC_leached_to_patch = compute_N_leached(
-				verbose_flag,
-				patch[0].soil_cs.DOC,
-				route_to_patch / patch[0].area,
-				patch[0].sat_deficit,
-				patch[0].soil_defaults[0][0].soil_water_cap,
-				m,
-				total_gamma / patch[0].area * time_int,
-				patch[0].soil_defaults[0][0].porosity_0,
-				patch[0].soil_defaults[0][0].porosity_decay,
-				patch[0].soil_defaults[0][0].DOM_decay_rate,
-				patch[0].soil_defaults[0][0].active_zone_z,
-				patch[0].soil_defaults[0][0].soil_depth,
-				patch[0].soil_defaults[0][0].DOC_adsorption_rate,
-				patch[0].transmissivity_profile);
+			DOC_leached_to_patch = leached[LEACH_DOC];
 			DOC_leached_to_stream = 0.0;
 			patch[0].soil_cs.DOC_Qout += (DOC_leached_to_patch + DOC_leached_to_stream);
-
 		}
 
 		patch[0].Qout += ((route_to_patch + route_to_stream) / patch[0].area);
@@ -464,82 +294,26 @@ void  update_drainage_road(
 	/*	- note only nitrate is assumed to follow return flow	*/
 	/*--------------------------------------------------------------*/
 	if (command_line[0].grow_flag > 0) {
-		Nout = compute_N_leached(
+		total[LEACH_NO3] = patch[0].soil_ns.nitrate - NO3_leached_to_patch;
+		total[LEACH_NH4] = patch[0].soil_ns.sminn - NH4_leached_to_patch;
+		total[LEACH_DON] = patch[0].soil_ns.DON - DON_leached_to_patch;
+		total[LEACH_DOC] = patch[0].soil_cs.DOC - DOC_leached_to_patch;
+		compute_solutes_leached(
 			verbose_flag,
-			patch[0].soil_ns.nitrate - NO3_leached_to_patch,
+			patch[0].soil_defaults[0],
+			total,
 			return_flow,
 			0.0,
 			0.0,
-			m,
-			total_gamma / patch[0].area * time_int,
-			patch[0].soil_defaults[0][0].porosity_0,
-			patch[0].soil_defaults[0][0].porosity_decay,
-			patch[0].soil_defaults[0][0].N_decay_rate,
-			patch[0].soil_defaults[0][0].active_zone_z,
-			patch[0].soil_defaults[0][0].soil_depth,
-			patch[0].soil_defaults[0][0].NO3_adsorption_rate,
-			patch[0].transmissivity_profile);
-		patch[0].surface_NO3 += Nout;
-		patch[0].soil_ns.NO3_Qout += Nout;
-
-
-		Nout = compute_N_leached(
-			verbose_flag,
-			patch[0].soil_ns.sminn- NH4_leached_to_patch,
-			return_flow,
-			0.0,
-			0.0,
-			m,
-			total_gamma / patch[0].area * time_int,
-			patch[0].soil_defaults[0][0].porosity_0,
-			patch[0].soil_defaults[0][0].porosity_decay,
-			patch[0].soil_defaults[0][0].N_decay_rate,
-			patch[0].soil_defaults[0][0].active_zone_z,
-			patch[0].soil_defaults[0][0].soil_depth,
-			patch[0].soil_defaults[0][0].NH4_adsorption_rate,
-			patch[0].transmissivity_profile);
-		patch[0].surface_NH4 += Nout;
-		patch[0].soil_ns.NH4_Qout += Nout;
-
-
-		Nout = compute_N_leached(
-			verbose_flag,
-			patch[0].soil_ns.DON - DON_leached_to_patch,
-			return_flow,
-			0.0,
-			0.0,
-			m,
-			total_gamma / patch[0].area * time_int,
-			patch[0].soil_defaults[0][0].porosity_0,
-			patch[0].soil_defaults[0][0].porosity_decay,
-			patch[0].soil_defaults[0][0].DOM_decay_rate,
-			patch[0].soil_defaults[0][0].active_zone_z,
-			patch[0].soil_defaults[0][0].soil_depth,
-			patch[0].soil_defaults[0][0].DON_adsorption_rate,
-			patch[0].transmissivity_profile);
-		patch[0].surface_DON += Nout;
-		patch[0].soil_ns.DON_Qout += Nout;
-
-
-		Nout = compute_N_leached(
-			verbose_flag,
-			patch[0].soil_cs.DOC - DOC_leached_to_patch,
-			return_flow,
-			0.0,
-			0.0,
-			m,
-			total_gamma / patch[0].area * time_int,
-			patch[0].soil_defaults[0][0].porosity_0,
-			patch[0].soil_defaults[0][0].porosity_decay,
-			patch[0].soil_defaults[0][0].DOM_decay_rate,
-			patch[0].soil_defaults[0][0].active_zone_z,
-			patch[0].soil_defaults[0][0].soil_depth,
-			patch[0].soil_defaults[0][0].DOC_adsorption_rate,
-			patch[0].transmissivity_profile);
-		patch[0].surface_DOC += Nout;
-		patch[0].soil_cs.DOC_Qout += Nout;
-
-		
+			leached);
+		patch[0].surface_NO3 += leached[LEACH_NO3];
+		patch[0].soil_ns.NO3_Qout += leached[LEACH_NO3];
+		patch[0].surface_NH4 += leached[LEACH_NH4];
+		patch[0].soil_ns.NH4_Qout += leached[LEACH_NH4];
+		patch[0].surface_DON += leached[LEACH_DON];
+		patch[0].soil_ns.DON_Qout += leached[LEACH_DON];
+		patch[0].surface_DOC += leached[LEACH_DOC];
+		patch[0].soil_cs.DOC_Qout += leached[LEACH_DOC];
 		}
 	
 	/*--------------------------------------------------------------*/
@@ -56,20 +56,13 @@ void  update_drainage_stream(
 		double,
 		double);
 	
-	double compute_N_leached(
-		int,
-		double,
-		double,
-		double,
-		double,
-		double,
-		double,
+	void	compute_solutes_leached(int,
+		struct soil_default *,
+		double *,
 		double,
 		double,
 		double,
-		double,
-		double,
-		double, double *);
+		double *);
 	
 	double compute_varbased_returnflow(
 		double,
@@ -79,12 +72,10 @@ void  update_drainage_stream(
 
 
 	double compute_varbased_flow(
-		int,
-		double,
-		double,
+		struct patch_object *,
 		double,
 		double,
-		double *);
+		double);
 
 	double recompute_gamma(	
 		struct patch_object *,
@@ -105,6 +96,7 @@ void  update_drainage_stream(
 	double  Qin, Qout,Qstr_total;  /* m */
 	double gamma, total_gamma, percent_tobe_routed;
 	double Nin, Nout;  /* kg/m2 */
+	double total[NUM_LEACH_SOLUTES], leached[NUM_LEACH_SOLUTES]; /* kg/m2 */
 	double t1,t2,t3;
 
 	d=0;
@@ -142,12 +134,10 @@ void  update_drainage_stream(
 	}
 
 	route_to_stream = compute_varbased_flow(
-		patch[0].num_soil_intervals,
+		patch,
 		patch[0].std * command_line[0].std_scale,
 		patch[0].sat_deficit,
-		gamma,
-		patch[0].soil_defaults[0][0].interval_size,
-		patch[0].transmissivity_profile);
+		gamma);
 	
 	
 	if (route_to_stream < 0.0) route_to_stream = 0.0;
@@ -157,74 +147,25 @@ void  update_drainage_stream(
 	/* compute Nitrogen leaching amount with baseflow		*/
 	/*--------------------------------------------------------------*/
 	if (command_line[0].grow_flag > 0) {
-
-		NO3_leached_to_stream = compute_N_leached(
+		total[LEACH_NO3] = patch[0].soil_ns.nitrate;
+		total[LEACH_NH4] = patch[0].soil_ns.sminn;
+		total[LEACH_DON] = patch[0].soil_ns.DON;
+		total[LEACH_DOC] = patch[0].soil_cs.DOC;
+		compute_solutes_leached(
 			verbose_flag,
-			patch[0].soil_ns.nitrate,
+			patch[0].soil_defaults[0],
+			total,
 			route_to_stream / patch[0].area,
 			patch[0].sat_deficit,
 			patch[0].soil_defaults[0][0].soil_water_cap,
-			m,
-			gamma / patch[0].area,
-			patch[0].soil_defaults[0][0].porosity_0,
-			patch[0].soil_defaults[0][0].porosity_decay,
-			patch[0].soil_defaults[0][0].N_decay_rate,
-			patch[0].soil_defaults[0][0].active_zone_z,
-			patch[0].soil_defaults[0][0].soil_depth,
-			patch[0].soil_defaults[0][0].NO3_adsorption_rate,
-			patch[0].transmissivity_profile);
+			leached);
+		NO3_leached_to_stream = leached[LEACH_NO3];
 		patch[0].soil_ns.NO3_Qout += NO3_leached_to_stream;
-
-
-		NH4_leached_to_stream = compute_N_leached(
-			verbose_flag,
-			patch[0].soil_ns.sminn,
-			route_to_stream / patch[0].area,
-			patch[0].sat_deficit,
-			patch[0].soil_defaults[0][0].soil_water_cap,
-			m,
-			gamma / patch[0].area,
-			patch[0].soil_defaults[0][0].porosity_0,
-			patch[0].soil_defaults[0][0].porosity_decay,
-			patch[0].soil_defaults[0][0].N_decay_rate,
-			patch[0].soil_defaults[0][0].active_zone_z,
-			patch[0].soil_defaults[0][0].soil_depth,
-			patch[0].soil_defaults[0][0].NH4_adsorption_rate,
-			patch[0].transmissivity_profile);
+		NH4_leached_to_stream = leached[LEACH_NH4];
 		patch[0].soil_ns.NH4_Qout += NH4_leached_to_stream;
-
-		DON_leached_to_stream = compute_N_leached(
-			verbose_flag,
-			patch[0].soil_ns.DON,
-			route_to_stream / patch[0].area,
-			patch[0].sat_deficit,
-			patch[0].soil_defaults[0][0].soil_water_cap,
-			m,
-			gamma / patch[0].area,
-			patch[0].soil_defaults[0][0].porosity_0,
-			patch[0].soil_defaults[0][0].porosity_decay,
-			patch[0].soil_defaults[0][0].DOM_decay_rate,
-			patch[0].soil_defaults[0][0].active_zone_z,
-			patch[0].soil_defaults[0][0].soil_depth,
-			patch[0].soil_defaults[0][0].DON_adsorption_rate,
-			patch[0].transmissivity_profile);
+		DON_leached_to_stream = leached[LEACH_DON];
 		patch[0].soil_ns.DON_Qout += DON_leached_to_stream;
-
-		DOC_leached_to_stream = compute_N_leached(
-			verbose_flag,
-			patch[0].soil_cs.DOC,
-			route_to_stream / patch[0].area,
-			patch[0].sat_deficit,
-			patch[0].soil_defaults[0][0].soil_water_cap,
-			m,
-			gamma / patch[0].area,
-			patch[0].soil_defaults[0][0].porosity_0,
-			patch[0].soil_defaults[0][0].porosity_decay,
-			patch[0].soil_defaults[0][0].DOM_decay_rate,
-			patch[0].soil_defaults[0][0].active_zone_z,
-			patch[0].soil_defaults[0][0].soil_depth,
-			patch[0].soil_defaults[0][0].DOC_adsorption_rate,
-			patch[0].transmissivity_profile);
+		DOC_leached_to_stream = leached[LEACH_DOC];
 		patch[0].soil_cs.DOC_Qout += DOC_leached_to_stream;
 		patch[0].streamflow_NO3 += NO3_leached_to_stream;
 		patch[0].streamflow_NH4 += NH4_leached_to_stream;
@@ -257,78 +198,26 @@ void  update_drainage_stream(
 	/* 	note only nitrate is assumed to follow return flow		*/
 	/*--------------------------------------------------------------*/
 	if (return_flow > ZERO) {
-		Nout = compute_N_leached(
-			verbose_flag,
-			patch[0].soil_ns.nitrate - NO3_leached_to_stream,
-			return_flow,
-			0.0,
-			0.0,
-			m,
-			gamma / patch[0].area,
-			patch[0].soil_defaults[0][0].porosity_0,
-			patch[0].soil_defaults[0][0].porosity_decay,
-			patch[0].soil_defaults[0][0].N_decay_rate,
-			patch[0].soil_defaults[0][0].active_zone_z,
-			patch[0].soil_defaults[0][0].soil_depth,
-			patch[0].soil_defaults[0][0].NO3_adsorption_rate,
-			patch[0].transmissivity_profile);
-		patch[0].surface_NO3 += Nout;
-		patch[0].soil_ns.NO3_Qout += Nout;
-
-		Nout = compute_N_leached(
-			verbose_flag,
-			patch[0].soil_ns.sminn - NH4_leached_to_stream,
-			return_flow,
-			0.0,
-			0.0,
-			m,
-			gamma / patch[0].area,
-			patch[0].soil_defaults[0][0].porosity_0,
-			patch[0].soil_defaults[0][0].porosity_decay,
-			patch[0].soil_defaults[0][0].N_decay_rate,
-			patch[0].soil_defaults[0][0].active_zone_z,
-			patch[0].soil_defaults[0][0].soil_depth,
-			patch[0].soil_defaults[0][0].NH4_adsorption_rate,
-			patch[0].transmissivity_profile);
-		patch[0].surface_NH4 += Nout;
-		patch[0].soil_ns.NH4_Qout += Nout;
-
-		Nout = compute_N_leached(
+		total[LEACH_NO3] = patch[0].soil_ns.nitrate - NO3_leached_to_stream;
+		total[LEACH_NH4] = patch[0].soil_ns.sminn - NH4_leached_to_stream;
+		total[LEACH_DON] = patch[0].soil_ns.DON - DON_leached_to_stream;
+		total[LEACH_DOC] = patch[0].soil_cs.DOC - DOC_leached_to_stream;
+		compute_solutes_leached(
 			verbose_flag,
-			patch[0].soil_ns.DON - DON_leached_to_stream,
+			patch[0].soil_defaults[0],
+			total,
 			return_flow,
 			0.0,
 			0.0,
-			m,
-			gamma / patch[0].area,
-			patch[0].soil_defaults[0][0].porosity_0,
-			patch[0].soil_defaults[0][0].porosity_decay,
-			patch[0].soil_defaults[0][0].DOM_decay_rate,
-			patch[0].soil_defaults[0][0].active_zone_z,
-			patch[0].soil_defaults[0][0].soil_depth,
-			patch[0].soil_defaults[0][0].DON_adsorption_rate,
-			patch[0].transmissivity_profile);
-		patch[0].surface_DON += Nout;
-		patch[0].soil_ns.DON_Qout += Nout;
-
-		Nout = compute_N_leached(
-			verbose_flag,
-			patch[0].soil_cs.DOC - DOC_leached_to_stream,
-			return_flow,
-			0.0,
-			0.0,
-			m,
-			gamma / patch[0].area,
-			patch[0].soil_defaults[0][0].porosity_0,
-			patch[0].soil_defaults[0][0].porosity_decay,
-			patch[0].soil_defaults[0][0].DOM_decay_rate,
-			patch[0].soil_defaults[0][0].active_zone_z,
-			patch[0].soil_defaults[0][0].soil_depth,
-			patch[0].soil_defaults[0][0].DOC_adsorption_rate,
-			patch[0].transmissivity_profile);
-		patch[0].surface_DOC += Nout;
-		patch[0].soil_cs.DOC_Qout += Nout;
-
+			leached);
+		patch[0].surface_NO3 += leached[LEACH_NO3];
+		patch[0].soil_ns.NO3_Qout += leached[LEACH_NO3];
+		patch[0].surface_NH4 += leached[LEACH_NH4];
+		patch[0].soil_ns.NH4_Qout += leached[LEACH_NH4];
+		patch[0].surface_DON += leached[LEACH_DON];
+		patch[0].soil_ns.DON_Qout += leached[LEACH_DON];
+		patch[0].surface_DOC += leached[LEACH_DOC];
+		patch[0].soil_cs.DOC_Qout += leached[LEACH_DOC];
 	}
 
 	/*--------------------------------------------------------------*/
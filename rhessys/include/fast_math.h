@@ -0,0 +1,104 @@
+#ifndef _FAST_MATH_H_
+#define _FAST_MATH_H_
+
+/*--------------------------------------------------------------*/
+/*	fast_math.h - polynomial exp, log and pow for the	*/
+/*	hydrology and radiation routines			*/
+/*								*/
+/*	EXP, LOG and POW are exp, log and pow unless rhessys	*/
+/*	is built with make FASTMATH=1 (-DFAST_MATH), which	*/
+/*	makes them the inline approximations below.  They	*/
+/*	have no table and, but for the fall back to libm	*/
+/*	outside their domain, no branch, so gcc can inline and	*/
+/*	vectorize them in loops.				*/
+/*								*/
+/*	Relative error bounds (truncation; rounding adds a few	*/
+/*	ulp), checked against libm over the whole domain:	*/
+/*								*/
+/*	fast_exp(x)	7.1e-9	x in [-708, 709]; x is clamped	*/
+/*			to that range, where exp would		*/
+/*			underflow or overflow			*/
+/*	fast_log(x)	2.1e-9	x positive and normal, else	*/
+/*			log(x)					*/
+/*	fast_pow(x,y)	2.1e-9 |y log(x)| + 7.1e-9, i.e. below	*/
+/*			1e-6 while the result is within		*/
+/*			1e-204 to 1e204; x <= 0 uses pow(x,y)	*/
+/*								*/
+/*	fast_exp reduces x = n ln2 + r, |r| <= ln2/2, with ln2	*/
+/*	split in two (Cody and Waite) and evaluates the degree	*/
+/*	7 Taylor polynomial of exp(r) by Estrin's scheme;	*/
+/*	the bound is exp(r) r^8 / 8!.  fast_log reduces		*/
+/*	x = 2^k m, m in [sqrt(2)/2, sqrt(2)), and sums		*/
+/*	log(m) = 2 atanh(s), s = (m-1)/(m+1), to s^9; the bound	*/
+/*	is s^10 / (11 (1 - s^2)) with |s| <= 0.1716.		*/
+/*								*/
+/*	The drift of the whole model is measured by the golden	*/
+/*	output tests, e.g. make test FASTMATH=1 (see		*/
+/*	test/README.txt).					*/
+/*--------------------------------------------------------------*/
+#include <math.h>
+#include <float.h>
+#include <stdint.h>
+
+#ifdef FAST_MATH
+#define	EXP(x)		fast_exp(x)
+#define	LOG(x)		fast_log(x)
+#define	POW(x, y)	fast_pow(x, y)
+#else
+#define	EXP(x)		exp(x)
+#define	LOG(x)		log(x)
+#define	POW(x, y)	pow(x, y)
+#endif
+
+#define	FM_LOG2E	1.4426950408889634	/* 1/ln2		*/
+#define	FM_LN2_HI	6.93147180369123816490e-01	/* ln2 to 32 bits	*/
+#define	FM_LN2_LO	1.90821492927058770002e-10	/* ln2 - FM_LN2_HI	*/
+#define	FM_ROUND	6755399441055744.0	/* 1.5 2^52; rounds to int	*/
+#define	FM_SQRT_HALF_BITS	0x3fe6a09e667f3bcdULL	/* sqrt(2)/2		*/
+
+static inline double fast_exp(double x)
+{
+	double	n, r, r2, r4, p;
+	union { double d; uint64_t i; } scale;
+
+	x = (x < -708.0) ? -708.0 : x;
+	x = (x > 709.0) ? 709.0 : x;
+	n = (x * FM_LOG2E + FM_ROUND) - FM_ROUND;
+	r = (x - n * FM_LN2_HI) - n * FM_LN2_LO;
+	r2 = r * r;
+	r4 = r2 * r2;
+	p = (1.0 + r) + r2 * (1.0/2.0 + r * (1.0/6.0))
+		+ r4 * ((1.0/24.0 + r * (1.0/120.0))
+		+ r2 * (1.0/720.0 + r * (1.0/5040.0)));
+	scale.i = (uint64_t) ((int64_t) n + 1023) << 52;
+	return(p * scale.d);
+}
+
+static inline double fast_log(double x)
+{
+	double	k, s, s2, s4, p;
+	uint64_t	t;
+	union { double d; uint64_t i; } bits;
+
+	if (!((x >= DBL_MIN) && (x <= DBL_MAX)))
+		return(log(x));
+	bits.d = x;
+	t = bits.i - FM_SQRT_HALF_BITS;
+	k = (double) ((int64_t) t >> 52);
+	bits.i -= t & (0xfffULL << 52);
+	s = (bits.d - 1.0) / (bits.d + 1.0);
+	s2 = s * s;
+	s4 = s2 * s2;
+	p = (1.0 + s2 * (1.0/3.0))
+		+ s4 * ((1.0/5.0 + s2 * (1.0/7.0)) + s4 * (1.0/9.0));
+	return(k * FM_LN2_HI + (k * FM_LN2_LO + 2.0 * s * p));
+}
+
+static inline double fast_pow(double x, double y)
+{
+	if (!(x > 0.0))
+		return(pow(x, y));
+	return(fast_exp(y * fast_log(x)));
+}
+
+#endif
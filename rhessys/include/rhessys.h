@@ -154,6 +154,7 @@
 #define MAXSTR	1024
 #define DtoR	  0.01745329  	
 #define PI	3.14159265359
+#define NUM_DECLINATIONS	47	/* entries in the declination table	*/
 #define seconds_per_day 86400
 #define	ess_snow	0.97
 #define	ess_soil	0.95
@@ -193,6 +194,14 @@
 #define PTYPEHIGH 4
 #define P1HIGH 5
 #define P2HIGH 6
+#define OUTPUT_COMP_NONE 0
+#define OUTPUT_COMP_GZIP 1
+#define OUTPUT_COMP_ZSTD 2
+#define LEACH_NO3 0
+#define LEACH_NH4 1
+#define LEACH_DON 2
+#define LEACH_DOC 3
+#define NUM_LEACH_SOLUTES 4
 
 
 /*----------------------------------------------------------*/
@@ -259,6 +268,7 @@ struct world_object
 	int		num_basin_files;
 	int		simulation_cycles;	
 	int		year_day;
+	int		declin_index;	/* day in the declination table	*/
 	int		ID;    
 	int		num_fire_grid_row;
 	int		num_fire_grid_col;
@@ -287,6 +297,7 @@ struct world_object
 	struct	default_object		*defaults;
 	struct	world_hourly_object	*hourly;
 	struct  fire_object		**fire_grid;
+	struct	redefine_index_object	*redefine_index;
 	};
 
 
@@ -316,6 +327,7 @@ struct	world_output_file_object
 /*----------------------------------------------------------*/
 struct	output_files_object
 	{
+	int	compression;	/* OUTPUT_COMP_* - files are pipes if not NONE */
 	FILE	*yearly;
 	FILE	*monthly;
 	FILE	*daily;
@@ -458,6 +470,12 @@ struct basin_object
 	int		ID;									
 	int		num_base_stations;
 	int		num_hillslopes;
+	int		n_routing_substeps;	/* today's (-adaptroute)	*/
+	int		routing_substep_min;	/* over the run		*/
+	int		routing_substep_max;	/* over the run		*/
+	long	routing_substep_days;	/* days routed		*/
+	long	routing_substep_dry_days;	/* days with <= 2 steps	*/
+	long	routing_substep_total;	/* steps over the run	*/
 	double  area;			/*  m2 		*/
 	double	x;			/*  meters 	*/	
 	double	y;			/*  meters	*/
@@ -471,6 +489,7 @@ struct basin_object
 	struct	base_station_object	**base_stations;
 	struct	basin_default		**defaults;
 	struct	basin_hourly_object	*hourly;
+	struct	basin_ephemeris_object	*ephemeris;	/* NUM_DECLINATIONS days */
 	struct	grow_basin_object	*grow;
 	struct	hillslope_object	**hillslopes;
 	struct	patch_object 		*outside_region;
@@ -495,6 +514,17 @@ struct	basin_hourly_object
 	double	optical_air_mass;		/*	DIM	*/
 	};
 
+/*----------------------------------------------------------*/
+/*	Define the basin solar geometry of one declination	*/
+/*	day; hourly[hour-1] is the basin hourly geometry.	*/
+/*----------------------------------------------------------*/
+struct	basin_ephemeris_object
+	{
+	double	daylength;			/*	s	*/
+	double	theta_noon;			/*	rads	*/
+	struct	basin_hourly_object	hourly[24];
+	};
+
 /*----------------------------------------------------------*/
 /*	Define grow_basin_object extension.  				*/
 /*----------------------------------------------------------*/
@@ -860,6 +890,10 @@ struct zone_object
 	double	tdewpoint;				/* degrees C	*/
 	double	vpd_max;				/* Pa		*/
 	double	w_horizon;	/* cos of angle to normal of flat	*/
+	double	beam_slope_sin_hourangle;	/* DIM; cos_beam_slope terms	*/
+	double	beam_slope_cos_hourangle;	/* DIM; from slope, aspect	*/
+	double	beam_slope_sin_declin;		/* DIM; and latitude		*/
+	double	sky_view_factor;		/* DIM; cos(slope/2)^2		*/
 	double  wind;            	                /* m/s  	*/
 	double  wind_direction;            	                /* degrees  	*/
 	struct	base_station_object	**base_stations;
@@ -925,6 +959,26 @@ struct	landuse_default
 	double	grazing_Closs;			/* kgC/m2/day */
 };
 /*----------------------------------------------------------*/
+/*	Define a soil profile table (-soiltable).				*/
+/*	storage[k] and below[k] are the pore volume above and	*/
+/*	below depth k*dz of a soil with porosity n_0*exp(-z/p)	*/
+/*	(below as if it had no bottom); bucket j holds the last	*/
+/*	k with storage[k] <= j/dS_inv.							*/
+/*----------------------------------------------------------*/
+struct	soil_profile_table
+	{
+	int	num_intervals;
+	int	*bucket;
+	double	n_0;						/* DIM */
+	double	p;						/* m */
+	double	soil_depth;					/* m */
+	double	dz;						/* m */
+	double	dS_inv;						/* 1/m */
+	double	*storage;					/* m of water */
+	double	*below;						/* m of water */
+	struct	soil_profile_table	*next;
+	};
+/*----------------------------------------------------------*/
 /*	Define an soil 	default object.						*/
 /*----------------------------------------------------------*/
 struct	soil_default
@@ -965,6 +1019,8 @@ struct	soil_default
 	double  N_decay_rate;					/* kg N /m */
 	double  NO3_adsorption_rate;				/* kg /kg soil */
 	double  NH4_adsorption_rate;				/* kg /kg soil */
+	double  leach_decay_rate[NUM_LEACH_SOLUTES];		/* kg N /m by LEACH_* */
+	double  leach_adsorption_rate[NUM_LEACH_SOLUTES];	/* kg /kg soil by LEACH_* */
 	double  denitrif_proportion;				/* (DIM) 0-1 */
 	double	DON_production_rate;					/* (DIM) 0-1 */
 	double	gl_c;						/* m/s */
@@ -1337,6 +1393,10 @@ struct patch_object
 	int		num_canopy_strata;
 	int		num_layers;
 	int		num_soil_intervals;				/* unitless */
+	int		spinup_frozen;		/* 0 or 1; skipped once converged in -spinup */
+	int		outlet_upstream;	/* 0, 1 drains to the -outlet patch, 2 dropped but kept allocated */
+	int		routing_active;		/* 0 or 1; routed this step in -routing_active_tol */
+	int		routing_skipped;	/* steps of outflow owed; -1 none owed */
 	double	x;									/* meters	*/
 	double	y;									/* meters	*/
 	double	z;									/* meters	*/
@@ -1501,6 +1561,9 @@ struct patch_object
 	double	sat_deficit;				/* meters water		*/
 	double	sat_deficit_z;				/* meters		*/
 	double	*transmissivity_profile;		/* array (m/day) */
+	double	*smoothed_transmissivity_profile;	/* array (m/day) for -stdev */
+	double	smoothed_transmissivity_std;		/* m water	*/
+	int	num_smoothed_intervals;			/* unitless */
 	struct	snowpack_object	snowpack;		/* meters		*/
 	double	preday_unsat_storage;			/* meters water		*/
 	double  preday_rz_storage;			/* meters water by Taehee Hwang */
@@ -1698,6 +1761,181 @@ struct	output_flag
 	int		hourly;
 	};
 
+/*----------------------------------------------------------*/
+/*	Define output schema objects.							*/
+/*	An output variable maps a name to either the byte offset	*/
+/*	of a double within the object at its level, or to an	*/
+/*	accessor function for derived values.  state is set for	*/
+/*	the stores a redefine_world_sparse event may reset.		*/
+/*----------------------------------------------------------*/
+#define SCHEMA_ZONE	0
+#define SCHEMA_PATCH	1
+#define SCHEMA_STRATUM	2
+#define SCHEMA_NUM_LEVELS	3
+#define SCHEMA_DAILY	0
+#define SCHEMA_HOURLY	1
+#define SCHEMA_NUM_STEPS	2
+
+struct	output_variable
+	{
+	char	*name;
+	size_t	offset;
+	double	(*accessor)(void *);
+	int	state;
+	};
+
+struct	output_schema_entry
+	{
+	int		num_vars;
+	struct	output_variable	**vars;
+	};
+
+struct	output_schema_object
+	{
+	struct	output_schema_entry	entry[SCHEMA_NUM_LEVELS][SCHEMA_NUM_STEPS];
+	};
+
+/*----------------------------------------------------------*/
+/*	Define the ID index used by sparse redefine events.	*/
+/*	One table per SCHEMA_* level, sorted by ID.			*/
+/*----------------------------------------------------------*/
+#define SPARSE_REDEFINE_MAGIC	"RHESSysSPARSE"
+#define SPARSE_REDEFINE_NAME_LEN	64
+
+struct	sparse_redefine_record		/* one value in a binary sparse file */
+	{
+	int	field;		/* index into the file's field table */
+	int	ID;
+	double	value;
+	};
+
+struct	redefine_index_entry
+	{
+	int	ID;
+	void	*object;
+	struct	patch_object	*patch;		/* the patch itself or a stratum's patch */
+	};
+
+struct	redefine_index_object
+	{
+	int	num_entries[SCHEMA_NUM_LEVELS];
+	struct	redefine_index_entry	*entries[SCHEMA_NUM_LEVELS];
+	};
+
+/*----------------------------------------------------------*/
+/*	Define an ensemble object.								*/
+/*	One row per member of the -ensemble parameter table;	*/
+/*	columns[j] gives the ENSEMBLE_* multiplier in column j.	*/
+/*----------------------------------------------------------*/
+#define ENSEMBLE_S_M	0
+#define ENSEMBLE_S_K	1
+#define ENSEMBLE_S_SOIL_DEPTH	2
+#define ENSEMBLE_SV_M	3
+#define ENSEMBLE_SV_K	4
+#define ENSEMBLE_SVALT_PA	5
+#define ENSEMBLE_SVALT_PO	6
+#define ENSEMBLE_GW_SAT_TO_GW	7
+#define ENSEMBLE_GW_LOSS	8
+#define ENSEMBLE_VGSEN_1	9
+#define ENSEMBLE_VGSEN_2	10
+#define ENSEMBLE_VGSEN_3	11
+#define ENSEMBLE_NUM_COLUMNS	12
+
+struct	ensemble_object
+	{
+	int	num_members;
+	int	num_columns;
+	int	*columns;
+	char	**labels;
+	double	**values;		/* [member][column] */
+	};
+
+/*----------------------------------------------------------*/
+/*	Define a profile object (-profile).						*/
+/*	One wall-clock timer per PROFILE_* region; regions		*/
+/*	nest, and the stack holds the regions now running so	*/
+/*	time spent in a child is taken off its parent's			*/
+/*	exclusive time.  Region numbers follow the nesting so	*/
+/*	the report can be printed in order as a tree.			*/
+/*----------------------------------------------------------*/
+#define PROFILE_CONSTRUCT_WORLD	0
+#define PROFILE_CLIMATE	1
+#define PROFILE_ROUTING_TOPOLOGY	2
+#define PROFILE_SIMULATION	3
+#define PROFILE_WORLD_DAILY_I	4
+#define PROFILE_ZONE_DAILY_I	5
+#define PROFILE_PATCH_DAILY_I	6
+#define PROFILE_WORLD_HOURLY	7
+#define PROFILE_WORLD_DAILY_F	8
+#define PROFILE_PATCH_DAILY_F	9
+#define PROFILE_CANOPY_STRATUM_DAILY_F	10
+#define PROFILE_TOP_MODEL	11
+#define PROFILE_SUBSURFACE_ROUTING	12
+#define PROFILE_STREAM_ROUTING	13
+#define PROFILE_HOURLY_OUTPUT	14
+#define PROFILE_DAILY_OUTPUT	15
+#define PROFILE_DAILY_GROWTH_OUTPUT	16
+#define PROFILE_MONTHLY_OUTPUT	17
+#define PROFILE_YEARLY_OUTPUT	18
+#define PROFILE_YEARLY_GROWTH_OUTPUT	19
+#define PROFILE_NUM_REGIONS	20
+#define PROFILE_MAX_DEPTH	16
+
+struct	profile_object
+	{
+	int		depth;
+	int		stack[PROFILE_MAX_DEPTH];
+	int		parent[PROFILE_NUM_REGIONS];	/* -1 for top level */
+	long	calls[PROFILE_NUM_REGIONS];
+	double	start_time;
+	double	started[PROFILE_MAX_DEPTH];		/* s, clock at region start */
+	double	child_time[PROFILE_MAX_DEPTH];	/* s, in children so far */
+	double	inclusive[PROFILE_NUM_REGIONS];	/* s */
+	double	exclusive[PROFILE_NUM_REGIONS];	/* s */
+	};
+
+/*----------------------------------------------------------*/
+/*	Define a telemetry object (-telemetry).					*/
+/*	Progress is reported at most every interval seconds	*/
+/*	of wall clock; output time is read from the profile		*/
+/*	timers of the output events.							*/
+/*----------------------------------------------------------*/
+struct	telemetry_object
+	{
+	long	num_patches;
+	long	start_julday;
+	long	num_days;		/* days in the run */
+	long	days_done;		/* days simulated so far */
+	double	interval;		/* s */
+	double	start_time;		/* s, clock at simulation start */
+	double	last_time;		/* s, clock at last report */
+	char	*status_filename;	/* NULL for none */
+	struct	date	last_date;		/* last day simulated */
+	};
+
+/*----------------------------------------------------------*/
+/*	Define a streamflow objective object (-obs).			*/
+/*	Observed flows are held by day of the run; the sums		*/
+/*	of squares about the observed mean (sst) cover the		*/
+/*	whole run so NSE can be bounded before the run ends.	*/
+/*----------------------------------------------------------*/
+#define OBJECTIVE_LOG_OFFSET	0.001	/* mm/day added to flows before log */
+
+struct	streamflow_objective_object
+	{
+	int	num_days;		/* days in the run */
+	int	num_obs;		/* days of the run with an observation */
+	int	n;			/* observed days simulated so far */
+	long	start_julday;
+	double	*obs;			/* mm/day by day of the run; < 0 if missing */
+	double	sst;			/* (mm/day)^2 */
+	double	log_sst;
+	double	sse;			/* (mm/day)^2 */
+	double	log_sse;
+	double	sum_obs;		/* mm, observed days simulated so far */
+	double	sum_error;		/* mm, simulated - observed */
+	};
+
 /*----------------------------------------------------------*/
 /* 	Define a command_line_object object.					*/
 /*----------------------------------------------------------*/
@@ -1736,6 +1974,28 @@ struct	command_line_object
 	int		noredist_flag;
 	int		vmort_flag;
 	int		version_flag;
+	int		output_schema_flag;
+	int		output_compression;
+	int		restart_flag;
+	int		ensemble_flag;
+	int		ensemble_jobs;
+	int		spinup_flag;
+	int		spinup_max_cycles;
+	int		obs_flag;
+	int		obs_threshold_flag;
+	int		branch_flag;
+	int		branch_jobs;
+	int		outlet_flag;
+	int		outlet_ID[3];		/* patch, zone, hillslope */
+	int		seed_flag;
+	int		profile_flag;
+	int		memreport_flag;
+	int		telemetry_flag;
+	int		soil_table_intervals;	/* per porosity_decay, 0 exact */
+	int		adaptive_routing_flag;
+	int		routing_substeps[2];	/* min, max per day	*/
+	int		routing_active_flag;
+	unsigned long	seed;		/* key of the counter-based random draws */
 	char	*output_prefix;
 	char	routing_filename[FILEPATH_LEN];
 	char	surface_routing_filename[FILEPATH_LEN];
@@ -1744,6 +2004,12 @@ struct	command_line_object
 	char	world_filename[FILEPATH_LEN];
 	char	world_header_filename[FILEPATH_LEN];
 	char	tec_filename[FILEPATH_LEN];
+	char	output_schema_filename[FILEPATH_LEN];
+	char	restart_filename[FILEPATH_LEN];
+	char	ensemble_filename[FILEPATH_LEN];
+	char	obs_filename[FILEPATH_LEN];
+	char	branch_filename[FILEPATH_LEN];
+	char	telemetry_filename[FILEPATH_LEN];	/* empty for none */
 	double  tmp_value;
 	double  cpool_mort_fract;
 	double	veg_sen1;
@@ -1759,6 +2025,11 @@ struct	command_line_object
 	double	vsen[2];
 	double	vsen_alt[2];
 	double	std_scale;
+	double	spinup_tol;
+	double	obs_threshold;
+	double	telemetry_interval;		/* s */
+	double	routing_substep_tol;	/* 0-1 */
+	double	routing_active_tol;	/* m/day */
 	double	thresholds[2];
 	struct	output_flag	output_flags;
 	struct	b_option	*b;
@@ -1767,12 +2038,38 @@ struct	command_line_object
 	struct	p_option	*p;
 	struct	c_option	*c;
 	struct	stro_option	*stro;
+	struct	output_schema_object	*output_schema;
+	struct	streamflow_objective_object	*objective;
+	struct	profile_object	*profile;
+	struct	telemetry_object	*telemetry;
 	struct	date		output_yearly_date;
 	struct	date		start_date;
 	struct	date		end_date;
 	};
 
 
+/*----------------------------------------------------------*/
+/*	Define a checkpoint header object.						*/
+/*	Written at the start of a binary checkpoint file; the	*/
+/*	struct sizes reject checkpoints from a different build.	*/
+/*----------------------------------------------------------*/
+#define CHECKPOINT_MAGIC	"RHESSysCHECKPT"
+#define CHECKPOINT_VERSION	2
+
+struct	checkpoint_header
+	{
+	char	magic[16];
+	int		version;
+	int		num_basins;
+	size_t	struct_sizes[6];
+	long	tec_offset;
+	unsigned long	seed;
+	struct	date	current_date;
+	struct	date	next_date;
+	struct	output_flag	output_flags;
+	struct	date	output_yearly_date;
+	};
+
 /*----------------------------------------------------------*/
 /*	Define a tec file object.								*/
 /*----------------------------------------------------------*/
@@ -69,6 +69,8 @@ struct basin_object *construct_basin(
 	/*--------------------------------------------------------------*/
 	/*	Local function definition.									*/
 	/*--------------------------------------------------------------*/
+	void	profile_start( struct profile_object *, int );
+	void	profile_stop( struct profile_object *, int );
 	struct base_station_object *assign_base_station(
 								int,
 								int,
@@ -82,6 +84,7 @@ struct basin_object *construct_basin(
 		struct	default_object *);
 	
 	void	*alloc( 	size_t, char *, char *);
+	void	construct_solar_ephemeris( struct basin_object * );
 	
 	void	sort_by_elevation( struct basin_object *);
 	
@@ -244,6 +247,18 @@ struct basin_object *construct_basin(
 	basin[0].defaults[0][0].n_routing_timesteps = 
 			(int) (n_routing_timesteps / basin[0].area);
 
+	/*--------------------------------------------------------------*/
+	/*	Tabulate the solar geometry of the basin and its zones.		*/
+	/*--------------------------------------------------------------*/
+	basin[0].ephemeris = NULL;
+	construct_solar_ephemeris(basin);
+	basin[0].n_routing_substeps = 0;
+	basin[0].routing_substep_min = 0;
+	basin[0].routing_substep_max = 0;
+	basin[0].routing_substep_days = 0;
+	basin[0].routing_substep_dry_days = 0;
+	basin[0].routing_substep_total = 0;
+
 	if (basin[0].defaults[0][0].n_routing_timesteps < 1)
 		basin[0].defaults[0][0].n_routing_timesteps = 1;
  
@@ -319,6 +334,7 @@ struct basin_object *construct_basin(
 	/*	Read in flow routing topology for routing option	*/
 	/*--------------------------------------------------------------*/
 	if ( command_line[0].routing_flag == 1 ) {
+		profile_start(command_line[0].profile, PROFILE_ROUTING_TOPOLOGY);
 		basin[0].outside_region = (struct patch_object *) alloc (1 *
 			sizeof(struct patch_object) , "patch",
 			"construct_basin");
@@ -347,6 +363,7 @@ struct basin_object *construct_basin(
 								command_line, true);
 			}
 		}
+		profile_stop(command_line[0].profile, PROFILE_ROUTING_TOPOLOGY);
 	}
 
 	/*--------------------------------------------------------------*/
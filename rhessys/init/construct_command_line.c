@@ -110,6 +110,35 @@ struct	command_line_object	*construct_command_line(
 	command_line[0].tmax_add = 0.0;
 	command_line[0].tmin_add = 0.0;
 	command_line[0].output_prefix = NULL;
+	command_line[0].output_schema_flag = 0;
+	command_line[0].output_schema = NULL;
+	command_line[0].output_compression = OUTPUT_COMP_NONE;
+	command_line[0].restart_flag = 0;
+	command_line[0].ensemble_flag = 0;
+	command_line[0].ensemble_jobs = 0;
+	command_line[0].spinup_flag = 0;
+	command_line[0].obs_flag = 0;
+	command_line[0].obs_threshold_flag = 0;
+	command_line[0].branch_flag = 0;
+	command_line[0].branch_jobs = 0;
+	command_line[0].outlet_flag = 0;
+	command_line[0].seed_flag = 0;
+	command_line[0].seed = 0;
+	command_line[0].profile_flag = 0;
+	command_line[0].profile = NULL;
+	command_line[0].memreport_flag = 0;
+	command_line[0].telemetry_flag = 0;
+	command_line[0].telemetry_interval = 0.0;
+	command_line[0].telemetry_filename[0] = '\0';
+	command_line[0].telemetry = NULL;
+	command_line[0].soil_table_intervals = 0;
+	command_line[0].adaptive_routing_flag = 0;
+	command_line[0].routing_substeps[0] = 1;
+	command_line[0].routing_substeps[1] = 96;
+	command_line[0].routing_substep_tol = 0.05;
+	command_line[0].routing_active_flag = 0;
+	command_line[0].routing_active_tol = 0.0;
+	command_line[0].objective = NULL;
 	command_line[0].output_flags.yearly = 0;
 	command_line[0].output_flags.monthly = 0;
 	command_line[0].output_flags.daily = 0;
@@ -1054,6 +1083,288 @@ struct	command_line_object	*construct_command_line(
 				i++;
 			}
 			/*--------------------------------------------------------------*/
+			/*		Check if the output schema file is next.				*/
+			/*--------------------------------------------------------------*/
+			else if( strcmp(main_argv[i],"-outschema") == 0 ){
+				i++;
+				if ((i == main_argc) || (valid_option(main_argv[i])==1)){
+					fprintf(stderr,"FATAL ERROR: Output schema file name not specified\n");
+					exit(EXIT_FAILURE);
+				} /*end if*/
+				command_line[0].output_schema_flag = 1;
+				strcpy(command_line[0].output_schema_filename,main_argv[i]);
+				i++;
+			}/*end if*/
+			/*--------------------------------------------------------------*/
+			/*		Check if the output compression option is next.			*/
+			/*--------------------------------------------------------------*/
+			else if( strcmp(main_argv[i],"-ocomp") == 0 ){
+				i++;
+				if ((i == main_argc) || (valid_option(main_argv[i])==1)){
+					fprintf(stderr,"FATAL ERROR: Output compression (gzip or zstd) not specified\n");
+					exit(EXIT_FAILURE);
+				} /*end if*/
+				if ( strcmp(main_argv[i],"gzip") == 0 )
+					command_line[0].output_compression = OUTPUT_COMP_GZIP;
+				else if ( strcmp(main_argv[i],"zstd") == 0 )
+					command_line[0].output_compression = OUTPUT_COMP_ZSTD;
+				else{
+					fprintf(stderr,"FATAL ERROR: Output compression %s is not gzip or zstd\n",
+						main_argv[i]);
+					exit(EXIT_FAILURE);
+				} /*end if*/
+				/*--------------------------------------------------------------*/
+				/*	the compressor runs as a separate process so it must		*/
+				/*	be on the path.												*/
+				/*--------------------------------------------------------------*/
+				if ( ((command_line[0].output_compression == OUTPUT_COMP_GZIP)
+					&& (system("command -v gzip > /dev/null 2>&1") != 0))
+					|| ((command_line[0].output_compression == OUTPUT_COMP_ZSTD)
+					&& (system("command -v zstd > /dev/null 2>&1") != 0)) ){
+					fprintf(stderr,"FATAL ERROR: %s not found for -ocomp\n", main_argv[i]);
+					exit(EXIT_FAILURE);
+				} /*end if*/
+				i++;
+			}/*end if*/
+			/*--------------------------------------------------------------*/
+			/*		Check if the restart option is next.					*/
+			/*--------------------------------------------------------------*/
+			else if( strcmp(main_argv[i],"-restart") == 0 ){
+				i++;
+				if ((i == main_argc) || (valid_option(main_argv[i])==1)){
+					fprintf(stderr,"FATAL ERROR: Checkpoint file name not specified\n");
+					exit(EXIT_FAILURE);
+				} /*end if*/
+				command_line[0].restart_flag = 1;
+				strcpy(command_line[0].restart_filename,main_argv[i]);
+				i++;
+			}/*end if*/
+			/*--------------------------------------------------------------*/
+			/*		Check if the ensemble option is next.					*/
+			/*--------------------------------------------------------------*/
+			else if( strcmp(main_argv[i],"-ensemble") == 0 ){
+				i++;
+				if ((i == main_argc) || (valid_option(main_argv[i])==1)){
+					fprintf(stderr,"FATAL ERROR: Ensemble table not specified\n");
+					exit(EXIT_FAILURE);
+				} /*end if*/
+				command_line[0].ensemble_flag = 1;
+				strcpy(command_line[0].ensemble_filename,main_argv[i]);
+				i++;
+				/*--------------------------------------------------------------*/
+				/*	optional number of members run at once						*/
+				/*--------------------------------------------------------------*/
+				if ((i < main_argc) && (valid_option(main_argv[i])==0)){
+					command_line[0].ensemble_jobs = (int)atoi(main_argv[i]);
+					if (command_line[0].ensemble_jobs < 1){
+						fprintf(stderr,"FATAL ERROR: -ensemble job count must be at least 1\n");
+						exit(EXIT_FAILURE);
+					} /*end if*/
+					i++;
+				} /*end if*/
+			}/*end if*/
+			/*--------------------------------------------------------------*/
+			/*		Check if the spinup option is next.						*/
+			/*--------------------------------------------------------------*/
+			else if( strcmp(main_argv[i],"-spinup") == 0 ){
+				i++;
+				if ((i >= main_argc-1) || (valid_option(main_argv[i])==1)
+					|| (valid_option(main_argv[i+1])==1)){
+					fprintf(stderr,"FATAL ERROR: -spinup needs a tolerance and a maximum number of cycles\n");
+					exit(EXIT_FAILURE);
+				} /*end if*/
+				command_line[0].spinup_flag = 1;
+				command_line[0].spinup_tol = (double)atof(main_argv[i]);
+				i++;
+				command_line[0].spinup_max_cycles = (int)atoi(main_argv[i]);
+				if ((command_line[0].spinup_tol < 0.0)
+					|| (command_line[0].spinup_max_cycles < 1)){
+					fprintf(stderr,"FATAL ERROR: -spinup tolerance must be >= 0 and cycles >= 1\n");
+					exit(EXIT_FAILURE);
+				} /*end if*/
+				i++;
+			}/*end if*/
+			/*--------------------------------------------------------------*/
+			/*		Check if the observed streamflow option is next.		*/
+			/*--------------------------------------------------------------*/
+			else if( strcmp(main_argv[i],"-obs") == 0 ){
+				i++;
+				if ((i == main_argc) || (valid_option(main_argv[i])==1)){
+					fprintf(stderr,"FATAL ERROR: Observed streamflow file not specified\n");
+					exit(EXIT_FAILURE);
+				} /*end if*/
+				command_line[0].obs_flag = 1;
+				strcpy(command_line[0].obs_filename,main_argv[i]);
+				i++;
+				/*--------------------------------------------------------------*/
+				/*	optional NSE below which the run is stopped					*/
+				/*--------------------------------------------------------------*/
+				if ((i < main_argc) && (valid_option(main_argv[i])==0)){
+					command_line[0].obs_threshold_flag = 1;
+					command_line[0].obs_threshold = (double)atof(main_argv[i]);
+					i++;
+				} /*end if*/
+			}/*end if*/
+			/*--------------------------------------------------------------*/
+			/*		Check if the branch option is next.						*/
+			/*--------------------------------------------------------------*/
+			else if( strcmp(main_argv[i],"-branch") == 0 ){
+				i++;
+				if ((i == main_argc) || (valid_option(main_argv[i])==1)){
+					fprintf(stderr,"FATAL ERROR: Branch scenario table not specified\n");
+					exit(EXIT_FAILURE);
+				} /*end if*/
+				command_line[0].branch_flag = 1;
+				strcpy(command_line[0].branch_filename,main_argv[i]);
+				i++;
+				/*--------------------------------------------------------------*/
+				/*	optional number of scenarios run at once					*/
+				/*--------------------------------------------------------------*/
+				if ((i < main_argc) && (valid_option(main_argv[i])==0)){
+					command_line[0].branch_jobs = (int)atoi(main_argv[i]);
+					if (command_line[0].branch_jobs < 1){
+						fprintf(stderr,"FATAL ERROR: -branch job count must be at least 1\n");
+						exit(EXIT_FAILURE);
+					} /*end if*/
+					i++;
+				} /*end if*/
+			}/*end if*/
+			/*--------------------------------------------------------------*/
+			/*		Check if the outlet option is next.						*/
+			/*--------------------------------------------------------------*/
+			else if( strcmp(main_argv[i],"-outlet") == 0 ){
+				i++;
+				if ((i >= main_argc-2) || (valid_option(main_argv[i])==1)
+					|| (valid_option(main_argv[i+1])==1)
+					|| (valid_option(main_argv[i+2])==1)){
+					fprintf(stderr,"FATAL ERROR: -outlet needs a patch, zone and hillslope ID\n");
+					exit(EXIT_FAILURE);
+				} /*end if*/
+				command_line[0].outlet_flag = 1;
+				command_line[0].outlet_ID[0] = (int)atoi(main_argv[i]);
+				command_line[0].outlet_ID[1] = (int)atoi(main_argv[i+1]);
+				command_line[0].outlet_ID[2] = (int)atoi(main_argv[i+2]);
+				i += 3;
+			}/*end if*/
+			/*--------------------------------------------------------------*/
+			/*		Check if the random seed option is next.				*/
+			/*--------------------------------------------------------------*/
+			else if( strcmp(main_argv[i],"-seed") == 0 ){
+				i++;
+				if ((i == main_argc) || (valid_option(main_argv[i])==1)){
+					fprintf(stderr,"FATAL ERROR: Random seed not specified\n");
+					exit(EXIT_FAILURE);
+				} /*end if*/
+				command_line[0].seed_flag = 1;
+				command_line[0].seed = strtoul(main_argv[i], NULL, 10);
+				i++;
+			}/*end if*/
+			/*--------------------------------------------------------------*/
+			/*	Check if the -profile timers are wanted.					*/
+			/*--------------------------------------------------------------*/
+			else if( strcmp(main_argv[i],"-profile") == 0 ){
+				command_line[0].profile_flag = 1;
+				i++;
+			}/*end if*/
+			/*--------------------------------------------------------------*/
+			/*	Check if allocations are to be tallied.						*/
+			/*--------------------------------------------------------------*/
+			else if( strcmp(main_argv[i],"-memreport") == 0 ){
+				command_line[0].memreport_flag = 1;
+				i++;
+			}/*end if*/
+			/*--------------------------------------------------------------*/
+			/*	Check if progress telemetry is wanted.						*/
+			/*--------------------------------------------------------------*/
+			else if( strcmp(main_argv[i],"-telemetry") == 0 ){
+				i++;
+				if ((i == main_argc) || (valid_option(main_argv[i])==1)){
+					fprintf(stderr,"FATAL ERROR: Telemetry interval not specified\n");
+					exit(EXIT_FAILURE);
+				} /*end if*/
+				command_line[0].telemetry_flag = 1;
+				command_line[0].telemetry_interval = (double)atof(main_argv[i]);
+				i++;
+				/*--------------------------------------------------------------*/
+				/*	optional status file										*/
+				/*--------------------------------------------------------------*/
+				if ((i < main_argc) && (valid_option(main_argv[i])==0)){
+					strcpy(command_line[0].telemetry_filename,main_argv[i]);
+					i++;
+				} /*end if*/
+			}/*end if*/
+			/*--------------------------------------------------------------*/
+			/*	Check if soil profiles are to be tabulated.					*/
+			/*--------------------------------------------------------------*/
+			else if( strcmp(main_argv[i],"-soiltable") == 0 ){
+				command_line[0].soil_table_intervals = 16;
+				i++;
+				/*--------------------------------------------------------------*/
+				/*	optional number of intervals per porosity_decay			*/
+				/*--------------------------------------------------------------*/
+				if ((i < main_argc) && (valid_option(main_argv[i])==0)){
+					command_line[0].soil_table_intervals = (int)atoi(main_argv[i]);
+					if (command_line[0].soil_table_intervals < 1){
+						fprintf(stderr,
+							"FATAL ERROR: -soiltable needs at least 1 interval\n");
+						exit(EXIT_FAILURE);
+					} /*end if*/
+					i++;
+				} /*end if*/
+			}/*end if*/
+			/*--------------------------------------------------------------*/
+			/*	Check if adaptive routing steps are next.					*/
+			/*--------------------------------------------------------------*/
+			else if( strcmp(main_argv[i],"-adaptroute") == 0 ){
+				command_line[0].adaptive_routing_flag = 1;
+				i++;
+				/*--------------------------------------------------------------*/
+				/*	optional minimum and maximum steps per day and tolerance	*/
+				/*--------------------------------------------------------------*/
+				if ((i < main_argc) && (valid_option(main_argv[i])==0)){
+					command_line[0].routing_substeps[0] = (int)atoi(main_argv[i]);
+					i++;
+					if ((i == main_argc) || (valid_option(main_argv[i])==1)){
+						fprintf(stderr,
+							"FATAL ERROR: -adaptroute needs a maximum with the minimum\n");
+						exit(EXIT_FAILURE);
+					} /*end if*/
+					command_line[0].routing_substeps[1] = (int)atoi(main_argv[i]);
+					i++;
+					if ((i < main_argc) && (valid_option(main_argv[i])==0)){
+						command_line[0].routing_substep_tol = (double)atof(main_argv[i]);
+						i++;
+					} /*end if*/
+				} /*end if*/
+				if ((command_line[0].routing_substeps[0] < 1)
+					|| (command_line[0].routing_substeps[1]
+					< command_line[0].routing_substeps[0])
+					|| (command_line[0].routing_substep_tol <= 0.0)){
+					fprintf(stderr,
+						"FATAL ERROR: -adaptroute needs 1 <= min <= max and tol > 0\n");
+					exit(EXIT_FAILURE);
+				} /*end if*/
+			}/*end if*/
+			/*--------------------------------------------------------------*/
+			/*	Check if the routing active set tolerance (m/day) is given.	*/
+			/*--------------------------------------------------------------*/
+			else if( strcmp(main_argv[i],"-routing_active_tol") == 0 ){
+				i++;
+				if ((i == main_argc) || (valid_option(main_argv[i])==1)){
+					fprintf(stderr,
+						"FATAL ERROR: -routing_active_tol needs a tolerance (m/day)\n");
+					exit(EXIT_FAILURE);
+				} /*end if*/
+				command_line[0].routing_active_flag = 1;
+				command_line[0].routing_active_tol = (double)atof(main_argv[i]);
+				if (command_line[0].routing_active_tol < 0.0){
+					fprintf(stderr,
+						"FATAL ERROR: -routing_active_tol needs tol >= 0\n");
+					exit(EXIT_FAILURE);
+				} /*end if*/
+				i++;
+			}/*end if*/
+			/*--------------------------------------------------------------*/
 			/*	NOTE:  ADD MORE OPTION PARSING HERE.						*/
 			/*--------------------------------------------------------------*/
 			/*--------------------------------------------------------------*/
@@ -1068,5 +1379,15 @@ struct	command_line_object	*construct_command_line(
 		} /*end if*/
 	} /*end while*/
 
+	/*--------------------------------------------------------------*/
+	/*	-spinup compares carbon and nitrogen pools, so it needs -g,	*/
+	/*	which may follow it on the command line.					*/
+	/*--------------------------------------------------------------*/
+	if ( (command_line[0].spinup_flag == 1)
+		&& (command_line[0].grow_flag == 0) ){
+		fprintf(stderr,"FATAL ERROR: -spinup needs the grow option (-g)\n");
+		exit(EXIT_FAILURE);
+	}
+
 	return(command_line);
 } /*end construct_command_line*/
@@ -0,0 +1,176 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					construct_ensemble							*/
+/*																*/
+/*	construct_ensemble - reads an ensemble parameter table		*/
+/*																*/
+/*	NAME														*/
+/*	construct_ensemble - reads an ensemble parameter table		*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	struct ensemble_object *construct_ensemble(					*/
+/*					char	*ensemble_filename)					*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Reads the table given with -ensemble.  The first line names	*/
+/*	the columns; the first column is the member label and the	*/
+/*	others are sensitivity multipliers, e.g.					*/
+/*																*/
+/*		member	s_m	s_k	sv_m	sv_k							*/
+/*		m001	0.5	1.0	1.0	1.0								*/
+/*		m002	1.0	2.0	0.8	1.5								*/
+/*																*/
+/*	Multiplier columns and the option they replace are			*/
+/*		s_m s_k s_soil_depth		-s							*/
+/*		sv_m sv_k					-sv							*/
+/*		svalt_pa svalt_po			-svalt						*/
+/*		gw_sat_to_gw gw_loss		-gw							*/
+/*		vgsen_1 vgsen_2 vgsen_3		-vgsen						*/
+/*	Any column may be omitted; omitted multipliers keep the		*/
+/*	value given on the command line (1.0 by default).			*/
+/*	Text following a # is a comment.							*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*	The label is appended to the output prefix, so it must be	*/
+/*	unique and usable in a file name.							*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rhessys.h"
+
+static char *ensemble_column_names[ENSEMBLE_NUM_COLUMNS] = {
+	"s_m", "s_k", "s_soil_depth",
+	"sv_m", "sv_k",
+	"svalt_pa", "svalt_po",
+	"gw_sat_to_gw", "gw_loss",
+	"vgsen_1", "vgsen_2", "vgsen_3"};
+
+struct ensemble_object *construct_ensemble(char *ensemble_filename)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local function definition.									*/
+	/*--------------------------------------------------------------*/
+	void	*alloc( size_t, char *, char * );
+
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	int	i, j, m, line_number, num_lines;
+	char	line[MAXSTR];
+	char	*token, *comment, *end;
+	FILE	*ensemble_file;
+	struct	ensemble_object	*ensemble;
+
+	if ( (ensemble_file = fopen(ensemble_filename, "r")) == NULL ){
+		fprintf(stderr,"FATAL ERROR: Unable to open ensemble table %s\n",
+			ensemble_filename);
+		exit(EXIT_FAILURE);
+	}
+	ensemble = (struct ensemble_object *)
+		alloc(sizeof(struct ensemble_object),
+		"ensemble","construct_ensemble");
+	ensemble[0].columns = (int *) alloc(ENSEMBLE_NUM_COLUMNS * sizeof(int),
+		"columns","construct_ensemble");
+	ensemble[0].num_columns = -1;
+
+	/*--------------------------------------------------------------*/
+	/*	count the lines so the member arrays are allocated once		*/
+	/*--------------------------------------------------------------*/
+	num_lines = 0;
+	while ( fgets(line, MAXSTR, ensemble_file) != NULL )
+		num_lines++;
+	rewind(ensemble_file);
+	ensemble[0].labels = (char **) alloc((num_lines + 1) * sizeof(char *),
+		"labels","construct_ensemble");
+	ensemble[0].values = (double **) alloc((num_lines + 1) * sizeof(double *),
+		"values","construct_ensemble");
+	ensemble[0].num_members = 0;
+
+	line_number = 0;
+	while ( fgets(line, MAXSTR, ensemble_file) != NULL ){
+		line_number++;
+		if ( (comment = strchr(line, '#')) != NULL )
+			*comment = '\0';
+		if ( (token = strtok(line, " \t\r\n")) == NULL )
+			continue;
+		/*--------------------------------------------------------------*/
+		/*	header line: map column names to multipliers				*/
+		/*--------------------------------------------------------------*/
+		if ( ensemble[0].num_columns < 0 ){
+			if ( strcmp(token, "member") != 0 ){
+				fprintf(stderr,
+					"FATAL ERROR: ensemble table %s must start with a header line beginning with member\n",
+					ensemble_filename);
+				exit(EXIT_FAILURE);
+			}
+			ensemble[0].num_columns = 0;
+			while ( (token = strtok(NULL, " \t\r\n")) != NULL ){
+				for (j=0; j < ENSEMBLE_NUM_COLUMNS; j++)
+					if ( strcmp(token, ensemble_column_names[j]) == 0 )
+						break;
+				if ( j == ENSEMBLE_NUM_COLUMNS ){
+					fprintf(stderr,
+						"FATAL ERROR: ensemble table %s: unknown column %s\n",
+						ensemble_filename, token);
+					exit(EXIT_FAILURE);
+				}
+				for (i=0; i < ensemble[0].num_columns; i++)
+					if ( ensemble[0].columns[i] == j ){
+						fprintf(stderr,
+							"FATAL ERROR: ensemble table %s: column %s given twice\n",
+							ensemble_filename, token);
+						exit(EXIT_FAILURE);
+					}
+				ensemble[0].columns[ensemble[0].num_columns++] = j;
+			}
+			continue;
+		}
+		/*--------------------------------------------------------------*/
+		/*	member line													*/
+		/*--------------------------------------------------------------*/
+		m = ensemble[0].num_members;
+		for (i=0; i < m; i++)
+			if ( strcmp(token, ensemble[0].labels[i]) == 0 ){
+				fprintf(stderr,
+					"FATAL ERROR: ensemble table %s line %d: member %s given twice\n",
+					ensemble_filename, line_number, token);
+				exit(EXIT_FAILURE);
+			}
+		ensemble[0].labels[m] = (char *) alloc((strlen(token) + 1) * sizeof(char),
+			"labels","construct_ensemble");
+		strcpy(ensemble[0].labels[m], token);
+		ensemble[0].values[m] = (double *)
+			alloc((ensemble[0].num_columns + 1) * sizeof(double),
+			"values","construct_ensemble");
+		for (j=0; j < ensemble[0].num_columns; j++){
+			token = strtok(NULL, " \t\r\n");
+			if ( (token == NULL)
+				|| ((ensemble[0].values[m][j] = strtod(token, &end)), *end != '\0') ){
+				fprintf(stderr,
+					"FATAL ERROR: ensemble table %s line %d: expected %d multipliers\n",
+					ensemble_filename, line_number, ensemble[0].num_columns);
+				exit(EXIT_FAILURE);
+			}
+		}
+		if ( strtok(NULL, " \t\r\n") != NULL ){
+			fprintf(stderr,
+				"FATAL ERROR: ensemble table %s line %d: expected %d multipliers\n",
+				ensemble_filename, line_number, ensemble[0].num_columns);
+			exit(EXIT_FAILURE);
+		}
+		ensemble[0].num_members += 1;
+	}
+	fclose(ensemble_file);
+	if ( ensemble[0].num_members == 0 ){
+		fprintf(stderr,"FATAL ERROR: ensemble table %s has no members\n",
+			ensemble_filename);
+		exit(EXIT_FAILURE);
+	}
+	return(ensemble);
+} /*end construct_ensemble*/
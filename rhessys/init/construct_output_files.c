@@ -39,7 +39,7 @@ struct	world_output_file_object *construct_output_files(
 	/*--------------------------------------------------------------*/
 	/*	Local function definition.									*/
 	/*--------------------------------------------------------------*/
-	struct	output_files_object	*construct_output_fileset(char *);
+	struct	output_files_object	*construct_output_fileset(char *, int);
 	void	*alloc(	size_t, char *, char *);
 	/*--------------------------------------------------------------*/
 	/*	Local variable definition.									*/
@@ -68,7 +68,8 @@ struct	world_output_file_object *construct_output_files(
 	if ( command_line[0].stro != NULL ){
 		strcpy(root,prefix);
 		strcat(root, "_streamrouting");
-		world_output_file[0].stream_routing = construct_output_fileset(root);
+		world_output_file[0].stream_routing = construct_output_fileset(root,
+			command_line[0].output_compression);
 	}
 	/*--------------------------------------------------------------*/
 	/*	Construct the basin output files.							*/
@@ -76,7 +77,8 @@ struct	world_output_file_object *construct_output_files(
 	if ( command_line[0].b != NULL ){
 		strcpy(root,prefix);
 		strcat(root, "_basin");
-		world_output_file[0].basin = construct_output_fileset(root);
+		world_output_file[0].basin = construct_output_fileset(root,
+			command_line[0].output_compression);
 	}
 	/*--------------------------------------------------------------*/
 	/*	Construct the hillslope output files.						*/
@@ -84,7 +86,8 @@ struct	world_output_file_object *construct_output_files(
 	if ( command_line[0].h != NULL ){
 		strcpy(root,prefix);
 		strcat(root, "_hillslope");
-		world_output_file[0].hillslope = construct_output_fileset(root);
+		world_output_file[0].hillslope = construct_output_fileset(root,
+			command_line[0].output_compression);
 	}
 	/*--------------------------------------------------------------*/
 	/*	Construct the zone output files.							*/
@@ -92,7 +95,8 @@ struct	world_output_file_object *construct_output_files(
 	if ( command_line[0].z != NULL ){
 		strcpy(root, prefix);
 		strcat(root, "_zone");
-		world_output_file[0].zone = construct_output_fileset(root);
+		world_output_file[0].zone = construct_output_fileset(root,
+			command_line[0].output_compression);
 	}
 	/*--------------------------------------------------------------*/
 	/*	Construct the patch output files.							*/
@@ -100,7 +104,8 @@ struct	world_output_file_object *construct_output_files(
 	if ( command_line[0].p != NULL ){
 		strcpy(root, prefix);
 		strcat(root, "_patch");
-		world_output_file[0].patch = construct_output_fileset(root);
+		world_output_file[0].patch = construct_output_fileset(root,
+			command_line[0].output_compression);
 	}
 	/*--------------------------------------------------------------*/
 	/*	Construct the canopy stratum output files.					*/
@@ -109,7 +114,8 @@ struct	world_output_file_object *construct_output_files(
 	if ( (command_line[0].c != NULL) || (command_line[0].p != NULL ) ){
 		strcpy(root, prefix);
 		strcat(root, "_stratum");
-		world_output_file[0].canopy_stratum = construct_output_fileset(root);
+		world_output_file[0].canopy_stratum = construct_output_fileset(root,
+			command_line[0].output_compression);
 	}
 	fprintf(stderr,"FINISHED CONSTRUCT OUTPUT FILES\n");
 	return(world_output_file);
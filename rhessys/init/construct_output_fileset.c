@@ -11,7 +11,8 @@
 /*																*/
 /*	SYNOPSIS													*/
 /*	struct	output_file_object	*construct_output_fileset(		*/
-/*								char	*root)					*/
+/*								char	*root,					*/
+/*								int	compression)				*/
 /*																*/
 /*	OPTIONS														*/
 /*																*/
@@ -31,15 +32,54 @@
 /*	time.  It may be useful for optimization to remove this last*/
 /*	restriction if a cluster computing envrionment is used.		*/
 /*																*/
+/*	If compression is OUTPUT_COMP_GZIP or OUTPUT_COMP_ZSTD		*/
+/*	(-ocomp) each file is a pipe into a gzip or zstd process	*/
+/*	writing <root>.<step>.gz or .zst, so compression runs in	*/
+/*	parallel with the simulation and the output routines are	*/
+/*	unchanged.  zstd is run with -T0 to compress in parallel	*/
+/*	blocks.  The files must be closed with					*/
+/*	destroy_output_fileset, which waits for the compressors.	*/
+/*																*/
 /*--------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200112L
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include "rhessys.h"
 
+#define OUTPUT_PIPE_BUFFER	262144
+
+static FILE *open_output_file(char *root, char *suffix, int compression)
+{
+	char	filename[256];
+	char	command[2*FILEPATH_LEN];
+	FILE	*outfile;
+
+	strcpy(filename, root);
+	strcat(filename, suffix);
+	if (compression == OUTPUT_COMP_NONE)
+		return(fopen(filename, "w"));
+	if (strchr(filename, '\'') != NULL){
+		fprintf(stderr,"FATAL ERROR: in construct_output_fileset, -ocomp output name %s contains a quote.\n",
+			filename);
+		exit(EXIT_FAILURE);
+	}
+	if (compression == OUTPUT_COMP_ZSTD)
+		sprintf(command, "zstd -q -f -T0 -o '%s.zst'", filename);
+	else
+		sprintf(command, "gzip -c > '%s.gz'", filename);
+	if ( (outfile = popen(command, "w")) == NULL )
+		return(NULL);
+	/*--------------------------------------------------------------*/
+	/*	A large buffer keeps the number of pipe writes small.		*/
+	/*--------------------------------------------------------------*/
+	setvbuf(outfile, NULL, _IOFBF, OUTPUT_PIPE_BUFFER);
+	return(outfile);
+}
 
 struct	output_files_object	*construct_output_fileset(
-													  char	*root)
+													  char	*root,
+													  int	compression)
 {
 	/*--------------------------------------------------------------*/
 	/*	Local function definition.									*/
@@ -48,7 +88,6 @@ struct	output_files_object	*construct_output_fileset(
 	/*--------------------------------------------------------------*/
 	/*	Local variable definition.									*/
 	/*--------------------------------------------------------------*/
-	char	filename[256];
 	struct	output_files_object	*fileset;
 	/*--------------------------------------------------------------*/
 	/*	Construct the basin output files.							*/
@@ -56,27 +95,20 @@ struct	output_files_object	*construct_output_fileset(
 	fileset = (struct output_files_object *)
 		alloc(1 * sizeof(struct output_files_object),
 		"fileset","construct_output_fileset");
-	strcpy(filename, root);
-	strcat(filename,".yearly");
-	if ( (fileset[0].yearly = fopen(filename , "w")) == NULL ){
+	fileset[0].compression = compression;
+	if ( (fileset[0].yearly = open_output_file(root, ".yearly", compression)) == NULL ){
 		fprintf(stderr,"FATAL ERROR: in construct_output_fileset.\n");
 		exit(EXIT_FAILURE);
 	} /*end if*/
-	strcpy(filename, root);
-	strcat(filename,".monthly");
-	if ( (fileset[0].monthly = fopen(filename , "w"))== NULL ){
+	if ( (fileset[0].monthly = open_output_file(root, ".monthly", compression)) == NULL ){
 		fprintf(stderr,"FATAL ERROR: in construct_output_fileset.\n");
 		exit(EXIT_FAILURE);
 	} /*end if*/
-	strcpy(filename, root);
-	strcat(filename,".daily");
-	if ( (fileset[0].daily = fopen(filename , "w"))	== NULL ){
+	if ( (fileset[0].daily = open_output_file(root, ".daily", compression)) == NULL ){
 		fprintf(stderr,"FATAL ERROR: in construct_output_file.\n");
 		exit(EXIT_FAILURE);
 	} /*end if*/
-	strcpy(filename, root);
-	strcat(filename,".hourly");
-	if ( (fileset[0].hourly = fopen(filename , "w")) == NULL ) {
+	if ( (fileset[0].hourly = open_output_file(root, ".hourly", compression)) == NULL ) {
 		fprintf(stderr,"FATAL ERROR: in construct_output_file.\n");
 		exit(EXIT_FAILURE);
 	} /*end if*/
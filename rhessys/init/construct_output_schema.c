@@ -0,0 +1,138 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					construct_output_schema						*/
+/*																*/
+/*	construct_output_schema - reads an output schema file		*/
+/*																*/
+/*	NAME														*/
+/*	construct_output_schema - reads an output schema file		*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	struct output_schema_object *construct_output_schema(		*/
+/*					char	*schema_filename)					*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Reads the file given with -outschema.  Each line names a	*/
+/*	spatial level, a time step and the variables to write		*/
+/*	for that level and time step, e.g.							*/
+/*																*/
+/*		patch	daily	sat_deficit rz_storage streamflow lai	*/
+/*		stratum	daily	cs.leafc epv.proj_lai cs.net_psn		*/
+/*		zone	hourly	rain metv.tavg							*/
+/*																*/
+/*	Levels are zone, patch and stratum; time steps are daily	*/
+/*	and hourly.  Text following a # is a comment.  Repeating	*/
+/*	a level and time step appends to its variable list.			*/
+/*	A level/time step with a schema replaces the fixed format	*/
+/*	output for that file; all others are unchanged.				*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*	Monthly and yearly output is not covered since those		*/
+/*	routines also reset the accumulators they print.			*/
+/*	Variable names are resolved with find_output_variable.		*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rhessys.h"
+
+struct output_schema_object *construct_output_schema(char *schema_filename)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local function definition.									*/
+	/*--------------------------------------------------------------*/
+	void	*alloc( size_t, char *, char * );
+	void	dealloc( void *, size_t, char *, char * );
+	struct	output_variable	*find_output_variable( int, char *);
+
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	int	level, step, line_number;
+	char	line[MAXSTR];
+	char	*token, *comment;
+	FILE	*schema_file;
+	struct	output_variable	*variable, **vars;
+	struct	output_schema_entry	*entry;
+	struct	output_schema_object	*schema;
+
+	if ( (schema_file = fopen(schema_filename, "r")) == NULL ){
+		fprintf(stderr,"FATAL ERROR: Unable to open output schema file %s\n",
+			schema_filename);
+		exit(EXIT_FAILURE);
+	}
+	schema = (struct output_schema_object *)
+		alloc(sizeof(struct output_schema_object),
+		"schema","construct_output_schema");
+
+	line_number = 0;
+	while ( fgets(line, MAXSTR, schema_file) != NULL ){
+		line_number++;
+		if ( (comment = strchr(line, '#')) != NULL )
+			*comment = '\0';
+		/*--------------------------------------------------------------*/
+		/*	level															*/
+		/*--------------------------------------------------------------*/
+		if ( (token = strtok(line, " \t\r\n")) == NULL )
+			continue;
+		if ( strcmp(token, "zone") == 0 )
+			level = SCHEMA_ZONE;
+		else if ( strcmp(token, "patch") == 0 )
+			level = SCHEMA_PATCH;
+		else if ( (strcmp(token, "stratum") == 0)
+			|| (strcmp(token, "canopy_stratum") == 0) )
+			level = SCHEMA_STRATUM;
+		else {
+			fprintf(stderr,
+				"FATAL ERROR: output schema %s line %d: unknown level %s\n",
+				schema_filename, line_number, token);
+			exit(EXIT_FAILURE);
+		}
+		/*--------------------------------------------------------------*/
+		/*	time step														*/
+		/*--------------------------------------------------------------*/
+		token = strtok(NULL, " \t\r\n");
+		if ( (token != NULL) && (strcmp(token, "daily") == 0) )
+			step = SCHEMA_DAILY;
+		else if ( (token != NULL) && (strcmp(token, "hourly") == 0) )
+			step = SCHEMA_HOURLY;
+		else {
+			fprintf(stderr,
+				"FATAL ERROR: output schema %s line %d: time step must be daily or hourly\n",
+				schema_filename, line_number);
+			exit(EXIT_FAILURE);
+		}
+		/*--------------------------------------------------------------*/
+		/*	variables														*/
+		/*--------------------------------------------------------------*/
+		entry = &(schema[0].entry[level][step]);
+		while ( (token = strtok(NULL, " \t\r\n")) != NULL ){
+			if ( (variable = find_output_variable(level, token)) == NULL ){
+				fprintf(stderr,
+					"FATAL ERROR: output schema %s line %d: unknown variable %s\n",
+					schema_filename, line_number, token);
+				exit(EXIT_FAILURE);
+			}
+			vars = (struct output_variable **)
+				alloc((entry[0].num_vars + 1) * sizeof(struct output_variable *),
+				"vars","construct_output_schema");
+			if ( entry[0].num_vars > 0 ){
+				memcpy(vars, entry[0].vars,
+					entry[0].num_vars * sizeof(struct output_variable *));
+				dealloc(entry[0].vars,
+					entry[0].num_vars * sizeof(struct output_variable *),
+					"vars","construct_output_schema");
+			}
+			vars[entry[0].num_vars] = variable;
+			entry[0].vars = vars;
+			entry[0].num_vars += 1;
+		}
+	}
+	fclose(schema_file);
+	return(schema);
+} /*end construct_output_schema*/
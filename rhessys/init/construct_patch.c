@@ -96,6 +96,10 @@ struct patch_object *construct_patch(
 	/*--------------------------------------------------------------*/
 	patch = (struct patch_object *) alloc( 1 *
 		sizeof( struct patch_object ),"patch","construct_patch");
+	patch[0].spinup_frozen = 0;
+	patch[0].routing_active = 1;
+	patch[0].routing_skipped = 0;
+	patch[0].outlet_upstream = 0;
 	
 	/*--------------------------------------------------------------*/
 	/*	Read in the next patch record for this hillslope.			*/
@@ -0,0 +1,52 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*						construct_profile						*/
+/*																*/
+/*	construct_profile - creates the -profile timers				*/
+/*																*/
+/*	NAME														*/
+/*	construct_profile - creates the -profile timers				*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	struct profile_object *construct_profile( void )			*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Allocates a profile object with every region timer at		*/
+/*	zero and notes the start time of the run, against which	*/
+/*	output_profile reports the total.							*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include "rhessys.h"
+
+struct profile_object *construct_profile( void )
+{
+	/*--------------------------------------------------------------*/
+	/*	Local function definition.									*/
+	/*--------------------------------------------------------------*/
+	void	*alloc( size_t, char *, char * );
+	double	profile_clock( void );
+
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	int	i;
+	struct	profile_object	*profile;
+
+	profile = (struct profile_object *) alloc(sizeof(struct profile_object),
+		"profile","construct_profile");
+	profile[0].depth = 0;
+	for (i=0; i < PROFILE_NUM_REGIONS; i++){
+		profile[0].parent[i] = -1;
+		profile[0].calls[i] = 0;
+		profile[0].inclusive[i] = 0.0;
+		profile[0].exclusive[i] = 0.0;
+	}
+	profile[0].start_time = profile_clock();
+	return(profile);
+} /*end construct_profile*/
@@ -0,0 +1,146 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					construct_redefine_index					*/
+/*																*/
+/*	construct_redefine_index - builds the ID index for sparse	*/
+/*			redefine events										*/
+/*																*/
+/*	NAME														*/
+/*	construct_redefine_index - builds the ID index for sparse	*/
+/*			redefine events										*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	struct redefine_index_object *construct_redefine_index(		*/
+/*					struct	world_object	*world)				*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Walks the world once and builds, for zones, patches and		*/
+/*	strata, a table of (ID, object) sorted by ID so that		*/
+/*	find_redefine_entry can resolve an ID with a binary search.	*/
+/*	Patch and stratum entries also carry the patch they			*/
+/*	belong to, for the updates that follow a redefine.			*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*	IDs must be unique within a level across the whole world;	*/
+/*	a duplicate is a fatal error since the sparse file could	*/
+/*	not say which object it means.								*/
+/*	The index is built on the first sparse redefine event and	*/
+/*	kept in the world object; the spatial structure does not	*/
+/*	change during a run.										*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include "rhessys.h"
+
+static int redefine_entry_compare(const void *e1, const void *e2)
+{
+	int	ID1, ID2;
+
+	ID1 = ((struct redefine_index_entry *)e1)->ID;
+	ID2 = ((struct redefine_index_entry *)e2)->ID;
+	return (ID1 < ID2) ? -1 : (ID1 > ID2) ? 1 : 0;
+}
+
+struct redefine_index_object *construct_redefine_index(
+							struct world_object *world)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local function definition.									*/
+	/*--------------------------------------------------------------*/
+	void	*alloc( size_t, char *, char * );
+
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	int	b, h, z, p, c, i, level;
+	int	n[SCHEMA_NUM_LEVELS];
+	struct	basin_object	*basin;
+	struct	hillslope_object	*hillslope;
+	struct	zone_object	*zone;
+	struct	patch_object	*patch;
+	struct	redefine_index_entry	*entry;
+	struct	redefine_index_object	*index;
+
+	/*--------------------------------------------------------------*/
+	/*	count the objects at each level								*/
+	/*--------------------------------------------------------------*/
+	for (level=0; level < SCHEMA_NUM_LEVELS; level++)
+		n[level] = 0;
+	for (b=0; b < world[0].num_basin_files; b++){
+		basin = world[0].basins[b];
+		for (h=0; h < basin[0].num_hillslopes; h++){
+			hillslope = basin[0].hillslopes[h];
+			for (z=0; z < hillslope[0].num_zones; z++){
+				zone = hillslope[0].zones[z];
+				n[SCHEMA_ZONE] += 1;
+				n[SCHEMA_PATCH] += zone[0].num_patches;
+				for (p=0; p < zone[0].num_patches; p++)
+					n[SCHEMA_STRATUM] += zone[0].patches[p][0].num_canopy_strata;
+			}
+		}
+	}
+	index = (struct redefine_index_object *)
+		alloc(sizeof(struct redefine_index_object),
+		"index","construct_redefine_index");
+	for (level=0; level < SCHEMA_NUM_LEVELS; level++){
+		index[0].entries[level] = (struct redefine_index_entry *)
+			alloc(n[level] * sizeof(struct redefine_index_entry),
+			"entries","construct_redefine_index");
+		index[0].num_entries[level] = 0;
+	}
+	/*--------------------------------------------------------------*/
+	/*	fill the tables												*/
+	/*--------------------------------------------------------------*/
+	for (b=0; b < world[0].num_basin_files; b++){
+		basin = world[0].basins[b];
+		for (h=0; h < basin[0].num_hillslopes; h++){
+			hillslope = basin[0].hillslopes[h];
+			for (z=0; z < hillslope[0].num_zones; z++){
+				zone = hillslope[0].zones[z];
+				entry = &(index[0].entries[SCHEMA_ZONE][
+					index[0].num_entries[SCHEMA_ZONE]++]);
+				entry[0].ID = zone[0].ID;
+				entry[0].object = zone;
+				entry[0].patch = NULL;
+				for (p=0; p < zone[0].num_patches; p++){
+					patch = zone[0].patches[p];
+					entry = &(index[0].entries[SCHEMA_PATCH][
+						index[0].num_entries[SCHEMA_PATCH]++]);
+					entry[0].ID = patch[0].ID;
+					entry[0].object = patch;
+					entry[0].patch = patch;
+					for (c=0; c < patch[0].num_canopy_strata; c++){
+						entry = &(index[0].entries[SCHEMA_STRATUM][
+							index[0].num_entries[SCHEMA_STRATUM]++]);
+						entry[0].ID = patch[0].canopy_strata[c][0].ID;
+						entry[0].object = patch[0].canopy_strata[c];
+						entry[0].patch = patch;
+					}
+				}
+			}
+		}
+	}
+	/*--------------------------------------------------------------*/
+	/*	sort and reject duplicate IDs								*/
+	/*--------------------------------------------------------------*/
+	for (level=0; level < SCHEMA_NUM_LEVELS; level++){
+		qsort(index[0].entries[level], index[0].num_entries[level],
+			sizeof(struct redefine_index_entry), redefine_entry_compare);
+		for (i=1; i < index[0].num_entries[level]; i++){
+			if (index[0].entries[level][i].ID == index[0].entries[level][i-1].ID){
+				fprintf(stderr,
+					"FATAL ERROR: in construct_redefine_index, ID %d is used by more than one %s\n",
+					index[0].entries[level][i].ID,
+					(level == SCHEMA_ZONE) ? "zone" :
+					(level == SCHEMA_PATCH) ? "patch" : "stratum");
+				exit(EXIT_FAILURE);
+			}
+		}
+	}
+	return(index);
+} /*end construct_redefine_index*/
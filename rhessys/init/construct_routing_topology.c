@@ -52,6 +52,7 @@ struct routing_list_object *construct_routing_topology(char *routing_filename,
 	void *alloc(size_t, char *, char *);
 
 	double * compute_transmissivity_curve( double, struct patch_object *, struct command_line_object *);
+	void	compute_smoothed_transmissivity( struct patch_object *, double);
 	
 	/*--------------------------------------------------------------*/
 	/*	Local variable definition.									*/
@@ -193,6 +194,9 @@ struct routing_list_object *construct_routing_topology(char *routing_filename,
 				}
 
 			patch[0].transmissivity_profile = compute_transmissivity_curve(gamma, patch, command_line);
+			patch[0].smoothed_transmissivity_profile = NULL;
+			compute_smoothed_transmissivity(patch,
+				patch[0].std * command_line[0].std_scale);
 		}
 
 
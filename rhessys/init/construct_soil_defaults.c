@@ -49,6 +49,8 @@ struct soil_default *construct_soil_defaults(
 		char	*);
 	
 	double compute_delta_water(int, double, double,	double, double, double);
+	struct soil_profile_table *construct_soil_profile_table(double, double,
+		double, int);
 	
 	/*--------------------------------------------------------------*/
 	/*	Local variable definition.				*/
@@ -186,6 +188,18 @@ struct soil_default *construct_soil_defaults(
 				default_object_list[i].soil_depth *= command_line[0].sen[SOIL_DEPTH];
 		}
 
+		/*--------------------------------------------------------------*/
+		/*	tabulate the porosity profile (-soiltable); 		*/
+		/*	compute_delta_water and compute_z_final find the	*/
+		/*	table by its porosity_0, porosity_decay and soil_depth	*/
+		/*--------------------------------------------------------------*/
+		if (command_line[0].soil_table_intervals > 0)
+			construct_soil_profile_table(
+			default_object_list[i].porosity_0,
+			default_object_list[i].porosity_decay,
+			default_object_list[i].soil_depth,
+			command_line[0].soil_table_intervals);
+
 		/*--------------------------------------------------------------*/
 		/*      calculate water_equivalent depth of soil                */
 		/*--------------------------------------------------------------*/
@@ -210,6 +224,14 @@ struct soil_default *construct_soil_defaults(
 		default_object_list[i].DON_production_rate = 	getDoubleParam(&paramCnt, &paramPtr, "DON_production_rate", "%lf", 0.03, 1);
 		default_object_list[i].DOC_adsorption_rate = 	getDoubleParam(&paramCnt, &paramPtr, "DOC_adsorption_rate", "%lf", 0.000023, 1);
 		default_object_list[i].DON_adsorption_rate = 	getDoubleParam(&paramCnt, &paramPtr, "DON_adsorption_rate", "%lf", 0.000001, 1);
+		default_object_list[i].leach_decay_rate[LEACH_NO3] = default_object_list[i].N_decay_rate;
+		default_object_list[i].leach_decay_rate[LEACH_NH4] = default_object_list[i].N_decay_rate;
+		default_object_list[i].leach_decay_rate[LEACH_DON] = default_object_list[i].DOM_decay_rate;
+		default_object_list[i].leach_decay_rate[LEACH_DOC] = default_object_list[i].DOM_decay_rate;
+		default_object_list[i].leach_adsorption_rate[LEACH_NO3] = default_object_list[i].NO3_adsorption_rate;
+		default_object_list[i].leach_adsorption_rate[LEACH_NH4] = default_object_list[i].NH4_adsorption_rate;
+		default_object_list[i].leach_adsorption_rate[LEACH_DON] = default_object_list[i].DON_adsorption_rate;
+		default_object_list[i].leach_adsorption_rate[LEACH_DOC] = default_object_list[i].DOC_adsorption_rate;
 		default_object_list[i].interval_size = 		getDoubleParam(&paramCnt, &paramPtr, "interval_size", "%lf", INTERVAL_SIZE, 1);
 
 		/*--------------------------------------------------------------*/
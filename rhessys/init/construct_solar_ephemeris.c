@@ -0,0 +1,145 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					construct_solar_ephemeris					*/
+/*																*/
+/*	construct_solar_ephemeris - tabulates the solar geometry	*/
+/*			of a basin and its zones							*/
+/*																*/
+/*	NAME														*/
+/*	construct_solar_ephemeris - tabulates the solar geometry	*/
+/*			of a basin and its zones							*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	void construct_solar_ephemeris(								*/
+/*			struct	basin_object	*basin)						*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	The declination takes one of NUM_DECLINATIONS values		*/
+/*	(compute_declination), so the solar geometry of a basin		*/
+/*	depends only on its latitude, the declination index and		*/
+/*	the hour.  This builds basin[0].ephemeris, one entry per	*/
+/*	declination index with the day length and noon zenith		*/
+/*	angle computed by basin_daily_I and the hour angles,		*/
+/*	cos_sza and optical air mass computed by basin_hourly for	*/
+/*	each of the 24 hours.  basin_daily_I and basin_hourly now	*/
+/*	only look these up.											*/
+/*																*/
+/*	For each zone the slope, aspect and latitude terms of the	*/
+/*	cosine of the beam slope angle (Eq. 8 Appendix D of			*/
+/*	"MTCLIM") and the sky view factor of diffuse radiation		*/
+/*	are kept in the zone, so zone_hourly combines them with		*/
+/*	the hour's cos_declin_sin_hourangle, cos_declin_cos_			*/
+/*	hourangle and sin_declin.									*/
+/*																*/
+/*	Called by construct_basin once the hillslopes are built,	*/
+/*	and again after a redefine_world, _mult or _thin event,		*/
+/*	which can change the latitude or zone slopes and aspects.	*/
+/*	A redefine_world_sparse event cannot set those, so it		*/
+/*	does not rebuild the tables.								*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*	The table entries use the expressions of basin_daily_I and	*/
+/*	basin_hourly term for term, so the lookups are bitwise the	*/
+/*	same as computing them each day and hour.  Unlike			*/
+/*	basin_hourly the air mass terms are also filled when the	*/
+/*	sun is down; they are not used then.						*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <math.h>
+#include "rhessys.h"
+#include "phys_constants.h"
+
+void	construct_solar_ephemeris(
+								  struct	basin_object	*basin)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local function definition.									*/
+	/*--------------------------------------------------------------*/
+	double	compute_declination( int );
+	void	*alloc(	size_t, char *, char *);
+
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	int	d, hour, h, z, ML;
+	double	declin, cos_declin, sin_declin;
+	double	cosegeom, sinegeom, coshss, hss;
+	double	air_mass_array[22]  =
+	{0.0, 2.90,3.05,3.21,3.39, 3.69, 3.82, 4.07, 4.37, 4.72, 5.12,
+	5.60,6.18,6.88,7.77,8.90,10.39,12.44,15.36,19.79,26.96,30.00};
+	struct	basin_ephemeris_object	*day;
+	struct	basin_hourly_object	*hourly;
+	struct	zone_object	*zone;
+
+	if (basin[0].ephemeris == NULL)
+		basin[0].ephemeris = (struct basin_ephemeris_object *) alloc(
+			NUM_DECLINATIONS * sizeof(struct basin_ephemeris_object),
+			"ephemeris","construct_solar_ephemeris");
+	for (d=0; d < NUM_DECLINATIONS; d++){
+		day = &(basin[0].ephemeris[d]);
+		declin = compute_declination(d);
+		cos_declin = cos(declin);
+		sin_declin = sin(declin);
+		/*--------------------------------------------------------------*/
+		/*	Daylength (seconds) and noon zenith angle, as in		*/
+		/*	basin_daily_I.											*/
+		/*--------------------------------------------------------------*/
+		cosegeom = cos(basin[0].latitude*DtoR) * cos_declin;
+		sinegeom = sin(basin[0].latitude*DtoR) * sin_declin;
+		coshss = -(sinegeom) / cosegeom;
+		if (coshss < -1.0) coshss = -1.0; /* 24-hr daylight */
+		if (coshss > 1.0) coshss = 1.0;   /* 0-hr daylight */
+		hss = acos(coshss);  /* hour angle at sunset (radians) */
+		day[0].daylength = 2.0 * hss * SECPERRAD;
+		day[0].theta_noon =  basin[0].latitude*DtoR - declin;
+		/*--------------------------------------------------------------*/
+		/*	Hourly geometry for hours 1 to 24, as in basin_hourly.	*/
+		/*--------------------------------------------------------------*/
+		for (hour=1; hour <= 24; hour++){
+			hourly = &(day[0].hourly[hour-1]);
+			hourly[0].hour_angle = (hour*3600-43200)*0.0041667*DtoR;
+			hourly[0].cos_hour_angle = cos(hourly[0].hour_angle);
+			hourly[0].sin_hour_angle = sin(hourly[0].hour_angle);
+			hourly[0].cos_sza = cos_declin
+				* basin[0].cos_latitude * hourly[0].cos_hour_angle
+				+ sin_declin * basin[0].sin_latitude;
+			hourly[0].optical_air_mass
+				= 1.0	/(hourly[0].cos_sza + 1.0e-7);
+			if ( hourly[0].optical_air_mass > 2.9 ) {
+				ML = ( (int) (acos(hourly[0].cos_sza)/0.0174533)) - 69;
+				if ( ML < 1 ) ML = 1;
+				if ( ML > 21 ) ML = 21;
+				hourly[0].optical_air_mass = air_mass_array[ML];
+			}
+			hourly[0].cos_declin_cos_hourangle
+				= cos_declin * hourly[0].cos_hour_angle;
+			hourly[0].cos_declin_sin_hourangle
+				= cos_declin * hourly[0].sin_hour_angle;
+		}
+	}
+	/*--------------------------------------------------------------*/
+	/*	Zone terms of the beam slope angle and sky view factor.	*/
+	/*--------------------------------------------------------------*/
+	for (h=0; h < basin[0].num_hillslopes; h++){
+		for (z=0; z < basin[0].hillslopes[h][0].num_zones; z++){
+			zone = basin[0].hillslopes[h][0].zones[z];
+			zone[0].beam_slope_sin_hourangle
+				= -1 * zone[0].sin_slope * zone[0].sin_aspect;
+			zone[0].beam_slope_cos_hourangle
+				= -1 * zone[0].cos_aspect * zone[0].sin_slope
+				* basin[0].sin_latitude + zone[0].cos_slope
+				* basin[0].cos_latitude;
+			zone[0].beam_slope_sin_declin
+				= zone[0].cos_aspect * zone[0].sin_slope
+				* basin[0].cos_latitude + zone[0].cos_slope
+				* basin[0].sin_latitude;
+			zone[0].sky_view_factor = pow(cos(zone[0].slope/2.0),2.0);
+		}
+	}
+	return;
+} /*end construct_solar_ephemeris*/
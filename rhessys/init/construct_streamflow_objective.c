@@ -0,0 +1,158 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*				construct_streamflow_objective					*/
+/*																*/
+/*	construct_streamflow_objective - reads observed streamflow	*/
+/*			for the -obs calibration objectives					*/
+/*																*/
+/*	NAME														*/
+/*	construct_streamflow_objective - reads observed streamflow	*/
+/*			for the -obs calibration objectives					*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	struct streamflow_objective_object							*/
+/*		*construct_streamflow_objective(						*/
+/*					char	*obs_filename,						*/
+/*					struct	date	start_date,					*/
+/*					struct	date	end_date)					*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Reads daily observed streamflow, one day per line:			*/
+/*																*/
+/*		year month day streamflow								*/
+/*																*/
+/*	with streamflow in mm/day, as in the basin daily output.	*/
+/*	Negative values mark missing days; days outside the run		*/
+/*	and text following a # are ignored.							*/
+/*																*/
+/*	The observed sums of squares about the mean are computed	*/
+/*	here over all observed days of the run, for NSE and for		*/
+/*	logNSE (log of flow + OBJECTIVE_LOG_OFFSET).				*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "rhessys.h"
+
+struct streamflow_objective_object *construct_streamflow_objective(
+									char	*obs_filename,
+									struct	date	start_date,
+									struct	date	end_date)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local function definition.									*/
+	/*--------------------------------------------------------------*/
+	void	*alloc( size_t, char *, char * );
+	long	julday( struct date );
+
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	int	i, line_number;
+	long	day;
+	char	line[MAXSTR];
+	char	*comment;
+	double	value, mean, log_mean;
+	FILE	*obs_file;
+	struct	date	obs_date;
+	struct	streamflow_objective_object	*objective;
+
+	if ( (obs_file = fopen(obs_filename, "r")) == NULL ){
+		fprintf(stderr,"FATAL ERROR: Unable to open observed streamflow file %s\n",
+			obs_filename);
+		exit(EXIT_FAILURE);
+	}
+	objective = (struct streamflow_objective_object *)
+		alloc(sizeof(struct streamflow_objective_object),
+		"objective","construct_streamflow_objective");
+	start_date.hour = 1;
+	end_date.hour = 1;
+	objective[0].start_julday = julday(start_date);
+	objective[0].num_days = (int) (julday(end_date) - objective[0].start_julday);
+	if (objective[0].num_days < 1){
+		fprintf(stderr,"FATAL ERROR: -obs needs a run of at least one day\n");
+		exit(EXIT_FAILURE);
+	}
+	objective[0].obs = (double *) alloc(objective[0].num_days * sizeof(double),
+		"obs","construct_streamflow_objective");
+	for (i=0; i < objective[0].num_days; i++)
+		objective[0].obs[i] = -1.0;
+
+	/*--------------------------------------------------------------*/
+	/*	read the observations that fall in the run					*/
+	/*--------------------------------------------------------------*/
+	line_number = 0;
+	obs_date.hour = 1;
+	while ( fgets(line, MAXSTR, obs_file) != NULL ){
+		line_number++;
+		if ( (comment = strchr(line, '#')) != NULL )
+			*comment = '\0';
+		if ( strspn(line, " \t\r\n") == strlen(line) )
+			continue;
+		if ( sscanf(line, "%ld %ld %ld %lf", &(obs_date.year),
+			&(obs_date.month), &(obs_date.day), &value) != 4 ){
+			fprintf(stderr,
+				"FATAL ERROR: observed streamflow file %s line %d: expected year month day streamflow\n",
+				obs_filename, line_number);
+			exit(EXIT_FAILURE);
+		}
+		day = julday(obs_date) - objective[0].start_julday;
+		if ( (day >= 0) && (day < objective[0].num_days) )
+			objective[0].obs[day] = value;
+	}
+	fclose(obs_file);
+
+	/*--------------------------------------------------------------*/
+	/*	sums of squares about the observed mean						*/
+	/*--------------------------------------------------------------*/
+	objective[0].num_obs = 0;
+	mean = 0.0;
+	log_mean = 0.0;
+	for (i=0; i < objective[0].num_days; i++){
+		if (objective[0].obs[i] >= 0.0){
+			objective[0].num_obs += 1;
+			mean += objective[0].obs[i];
+			log_mean += log(objective[0].obs[i] + OBJECTIVE_LOG_OFFSET);
+		}
+	}
+	if (objective[0].num_obs < 2){
+		fprintf(stderr,
+			"FATAL ERROR: observed streamflow file %s has fewer than 2 days in the run\n",
+			obs_filename);
+		exit(EXIT_FAILURE);
+	}
+	mean /= objective[0].num_obs;
+	log_mean /= objective[0].num_obs;
+	objective[0].sst = 0.0;
+	objective[0].log_sst = 0.0;
+	for (i=0; i < objective[0].num_days; i++){
+		if (objective[0].obs[i] >= 0.0){
+			objective[0].sst += (objective[0].obs[i] - mean)
+				* (objective[0].obs[i] - mean);
+			objective[0].log_sst
+				+= (log(objective[0].obs[i] + OBJECTIVE_LOG_OFFSET) - log_mean)
+				* (log(objective[0].obs[i] + OBJECTIVE_LOG_OFFSET) - log_mean);
+		}
+	}
+	if ( (objective[0].sst <= 0.0) || (objective[0].log_sst <= 0.0) ){
+		fprintf(stderr,
+			"FATAL ERROR: observed streamflow in %s does not vary over the run\n",
+			obs_filename);
+		exit(EXIT_FAILURE);
+	}
+	objective[0].n = 0;
+	objective[0].sse = 0.0;
+	objective[0].log_sse = 0.0;
+	objective[0].sum_obs = 0.0;
+	objective[0].sum_error = 0.0;
+	printf("\n Read %d days of observed streamflow from %s\n",
+		objective[0].num_obs, obs_filename);
+	return(objective);
+} /*end construct_streamflow_objective*/
@@ -185,10 +185,14 @@ struct tec_object	*construct_tec(
 			(strcmp(command,"redefine_world") != 0) &&
 			(strcmp(command,"redefine_world_multiplier") != 0) &&
 			(strcmp(command,"redefine_world_thin_remain") != 0) &&
-			(strcmp(command,"redefine_world_thin_harvest") != 0) &&			
+			(strcmp(command,"redefine_world_thin_harvest") != 0) &&
+			(strcmp(command,"redefine_world_sparse") != 0) &&			
 			(strcmp(command,"roads_on") != 0) &&
 			(strcmp(command,"roads_off") != 0) &&
-			(strcmp(command,"output_current_state") != 0)  ){
+			(strcmp(command,"output_current_state") != 0) &&
+			(strcmp(command,"output_checkpoint") != 0) &&
+			(strcmp(command,"branch") != 0) &&
+			(strcmp(command,"output_memory_report") != 0)  ){
 			fprintf(stderr,
 				"\nFATAL ERROR: in construct_tec bad command %s for date %d %d %d %d\n ",
 				command, current_date.year,
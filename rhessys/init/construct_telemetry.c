@@ -0,0 +1,77 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					construct_telemetry							*/
+/*																*/
+/*	construct_telemetry - sets up -telemetry progress reports	*/
+/*																*/
+/*	NAME														*/
+/*	construct_telemetry - sets up -telemetry progress reports	*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	struct telemetry_object *construct_telemetry(				*/
+/*			struct	command_line_object	*command_line,			*/
+/*			struct	world_object	*world)						*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Counts the patches of the world and the days from its		*/
+/*	start to end date, against which output_telemetry			*/
+/*	reports progress, and notes the clock.  Called just			*/
+/*	before the simulation starts.								*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <string.h>
+#include "rhessys.h"
+
+struct telemetry_object *construct_telemetry(
+						struct	command_line_object	*command_line,
+						struct	world_object	*world)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local function definition.									*/
+	/*--------------------------------------------------------------*/
+	void	*alloc( size_t, char *, char * );
+	double	profile_clock( void );
+	long	julday( struct date );
+
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	int	b, h, z;
+	struct	telemetry_object	*telemetry;
+	struct	hillslope_object	*hillslope;
+
+	telemetry = (struct telemetry_object *)
+		alloc(sizeof(struct telemetry_object),
+		"telemetry","construct_telemetry");
+	telemetry[0].num_patches = 0;
+	for (b=0; b < world[0].num_basin_files; b++)
+		for (h=0; h < world[0].basins[b][0].num_hillslopes; h++){
+			hillslope = world[0].basins[b][0].hillslopes[h];
+			for (z=0; z < hillslope[0].num_zones; z++)
+				telemetry[0].num_patches += hillslope[0].zones[z][0].num_patches;
+		}
+	telemetry[0].start_julday = julday(world[0].start_date);
+	telemetry[0].num_days = julday(world[0].end_date)
+		- telemetry[0].start_julday;
+	telemetry[0].days_done = 0;
+	telemetry[0].last_date = world[0].start_date;
+	telemetry[0].interval = command_line[0].telemetry_interval;
+	if (strlen(command_line[0].telemetry_filename) > 0){
+		telemetry[0].status_filename = (char *)
+			alloc((strlen(command_line[0].telemetry_filename) + 1)
+			* sizeof(char), "status_filename","construct_telemetry");
+		strcpy(telemetry[0].status_filename,
+			command_line[0].telemetry_filename);
+	}
+	else
+		telemetry[0].status_filename = NULL;
+	telemetry[0].start_time = profile_clock();
+	telemetry[0].last_time = telemetry[0].start_time;
+	return(telemetry);
+} /*end construct_telemetry*/
@@ -349,6 +349,8 @@ struct world_object *construct_world(struct command_line_object *command_line){
 	/*----------------------------------------------------*/
 	/*	Local function definition.			     		  */
 	/*----------------------------------------------------*/
+	void	profile_start( struct profile_object *, int );
+	void	profile_stop( struct profile_object *, int );
 	char	**construct_filename_list( FILE *, int);
 	long	julday( struct date );
 	struct basin_default *construct_basin_defaults(int, char **, struct command_line_object *);
@@ -365,6 +367,8 @@ struct world_object *construct_world(struct command_line_object *command_line){
 	struct fire_struct **construct_fire_grid(struct world_object *, struct command_line_object *);
 	struct base_station_object **construct_ascii_grid(char *, struct date, struct date);
 	void *alloc(size_t, char *, char *);
+	void fork_ensemble_members(struct command_line_object *);
+	void prune_world_to_outlet(struct world_object *, struct command_line_object *);
 /*
 	void  construct_dclim(struct world_object *);
 */
@@ -372,6 +376,7 @@ struct world_object *construct_world(struct command_line_object *command_line){
 	/*	Local variable definition.									*/
 	/*--------------------------------------------------------------*/
 	FILE	*world_file;
+	long	world_file_offset;
 	FILE	*header_file;
 	int 	header_file_flag = 0;
 	int		legacy_worldfile = 0;
@@ -653,6 +658,61 @@ struct world_object *construct_world(struct command_line_object *command_line){
 		world[0].num_base_station_files = world[0].num_base_stations;
 	}
 
+	/*--------------------------------------------------------------*/
+	/*	Construct the list of base stations.			*/
+	/*--------------------------------------------------------------*/
+
+	if (command_line[0].dclim_flag == 0) {
+		profile_start(command_line[0].profile, PROFILE_CLIMATE);
+		/*--------------------------------------------------------------*/
+		/*	Construct the base_stations.				*/
+		/*--------------------------------------------------------------*/
+		printf("\n Constructing base stations flag is %d\n", command_line[0].gridded_ascii_flag);
+		
+		if ( command_line[0].gridded_ascii_flag == 1) {
+		   printf("\n starting construct_ascii_grid");
+			world[0].base_stations = construct_ascii_grid( world[0].base_station_files[0],
+								  world[0].start_date, 
+								  world[0].duration);
+		} else {
+			
+			world[0].base_stations = (struct base_station_object **)
+			alloc(world[0].num_base_stations *
+				  sizeof(struct base_station_object *),"base_stations","construct_world" );
+		
+			
+			for (i=0; i<world[0].num_base_stations; i++ ) {
+				world[0].base_stations[i] = construct_base_station(
+					world[0].base_station_files[i],
+					world[0].start_date, world[0].duration);
+			} /*end for*/
+		}
+		profile_stop(command_line[0].profile, PROFILE_CLIMATE);
+	} /*end if dclim_flag*/
+/*
+		construct_dclim(world);
+*/
+
+	printf("\n Finished constructing base stations\n");
+
+	/*--------------------------------------------------------------*/
+	/*	In ensemble mode fork the members here, so the climate is	*/
+	/*	read once and shared.  Only the members return; each		*/
+	/*	reopens the worldfile so they do not share a file offset,	*/
+	/*	then builds defaults with its own sensitivity multipliers.	*/
+	/*--------------------------------------------------------------*/
+	if (command_line[0].ensemble_flag == 1) {
+		world_file_offset = ftell(world_file);
+		fork_ensemble_members(command_line);
+		if ( (world_file = freopen(command_line[0].world_filename, "r",
+			world_file)) == NULL ){
+			fprintf(stderr,"FATAL ERROR:  Cannot reopen world file %s\n",
+				command_line[0].world_filename);
+			exit(EXIT_FAILURE);
+		}
+		fseek(world_file, world_file_offset, SEEK_SET);
+	}
+
 	/*--------------------------------------------------------------*/
 	/*	Construct the basin_defaults objects.			*/
 	/*--------------------------------------------------------------*/
@@ -715,45 +775,9 @@ struct world_object *construct_world(struct command_line_object *command_line){
 			world[0].surface_energy_default_files, command_line);
 	}
 
-
-	/*--------------------------------------------------------------*/
-	/*	Construct the list of base stations.			*/
-	/*--------------------------------------------------------------*/
-
-	if (command_line[0].dclim_flag == 0) {
-		/*--------------------------------------------------------------*/
-		/*	Construct the base_stations.				*/
-		/*--------------------------------------------------------------*/
-		printf("\n Constructing base stations flag is %d\n", command_line[0].gridded_ascii_flag);
-		
-		if ( command_line[0].gridded_ascii_flag == 1) {
-		   printf("\n starting construct_ascii_grid");
-			world[0].base_stations = construct_ascii_grid( world[0].base_station_files[0],
-								  world[0].start_date, 
-								  world[0].duration);
-		} else {
-			
-			world[0].base_stations = (struct base_station_object **)
-			alloc(world[0].num_base_stations *
-				  sizeof(struct base_station_object *),"base_stations","construct_world" );
-		
-			
-			for (i=0; i<world[0].num_base_stations; i++ ) {
-				world[0].base_stations[i] = construct_base_station(
-					world[0].base_station_files[i],
-					world[0].start_date, world[0].duration);
-			} /*end for*/
-		}
-	} /*end if dclim_flag*/
-/*
-		construct_dclim(world);
-*/
-
 	/*--------------------------------------------------------------*/
 	/*	Read in the world ID.							*/
 	/*--------------------------------------------------------------*/
-
-	printf("\n Finished constructing base stations\n");
 	fscanf(world_file,"%d",&(world[0].ID));
 	read_record(world_file, record);
 
@@ -781,11 +805,17 @@ struct world_object *construct_world(struct command_line_object *command_line){
 			world[0].base_stations,	world[0].defaults);
 	} /*end for*/
 	/*--------------------------------------------------------------*/
+	/*	Keep only the area draining to the outlet if one is given.	*/
+	/*--------------------------------------------------------------*/
+	if (command_line[0].outlet_flag == 1)
+		prune_world_to_outlet(world, command_line);
+	/*--------------------------------------------------------------*/
 	/* if fire spread flag is set					*/
 	/*	Construct the fire grid object.				*/
 	/*--------------------------------------------------------------*/
 	world[0].num_fire_grid_row = 0;
 	world[0].num_fire_grid_col = 0;
+	world[0].redefine_index = NULL;
 	if (command_line[0].firespread_flag == 1) {
 		world[0].fire_grid = construct_fire_grid(world, command_line);
 
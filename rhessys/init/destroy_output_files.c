@@ -63,10 +63,16 @@ void	destroy_output_files(
 	/*--------------------------------------------------------------*/
 	/*	Destroy the canopy_stratum output files.		*/
 	/*--------------------------------------------------------------*/
-	if ( command_line[0].c != NULL ){
+	if ( (command_line[0].c != NULL) || (command_line[0].p != NULL) ){
 		destroy_output_fileset( output[0].canopy_stratum);
 	}
 	/*--------------------------------------------------------------*/
+	/*	Destroy the stream_routing output files.		*/
+	/*--------------------------------------------------------------*/
+	if ( command_line[0].stro != NULL ){
+		destroy_output_fileset( output[0].stream_routing);
+	}
+	/*--------------------------------------------------------------*/
 	/*	Destroy the world output file object.						*/
 	/*--------------------------------------------------------------*/
 	if ((command_line[0].b != NULL) || (command_line[0].h != NULL) ||
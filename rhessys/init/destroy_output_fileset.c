@@ -22,6 +22,7 @@
 /*																*/
 /*																*/
 /*--------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200112L
 #include <stdio.h>
 #include "rhessys.h"
 void	destroy_output_fileset(	 struct	output_files_object *fileset)
@@ -37,10 +38,21 @@ void	destroy_output_fileset(	 struct	output_files_object *fileset)
 	/*--------------------------------------------------------------*/
 	/*	close the basin output files.							*/
 	/*--------------------------------------------------------------*/
-	fclose(  fileset[0].yearly );
-	fclose(  fileset[0].monthly );
-	fclose(  fileset[0].daily );
-	fclose(  fileset[0].hourly );
+	if ( fileset[0].compression != OUTPUT_COMP_NONE ){
+		/*--------------------------------------------------------------*/
+		/*	pclose waits for the compressor to finish the file.		*/
+		/*--------------------------------------------------------------*/
+		pclose(  fileset[0].yearly );
+		pclose(  fileset[0].monthly );
+		pclose(  fileset[0].daily );
+		pclose(  fileset[0].hourly );
+	}
+	else{
+		fclose(  fileset[0].yearly );
+		fclose(  fileset[0].monthly );
+		fclose(  fileset[0].daily );
+		fclose(  fileset[0].hourly );
+	}
 	free( fileset );
 	return;
 } /*end destroy_output_fileset*/
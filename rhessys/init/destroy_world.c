@@ -55,10 +55,10 @@ void destroy_world(struct command_line_object *command_line,
 	void	destroy_soil_defaults(
 		int,
 		int,
-		struct soil_default * );
-	void	destroy_landuse_defaults(
-		int,
-		int,
+		struct soil_default * );
+	void	destroy_landuse_defaults(
+		int,
+		int,
 		struct landuse_default * );
 	void	destroy_surface_energy_defaults(
 		int,
@@ -106,20 +106,20 @@ void destroy_world(struct command_line_object *command_line,
 	destroy_soil_defaults(
 		world[0].defaults[0].num_soil_default_files,
 		command_line[0].grow_flag,
-		world[0].defaults[0].soil);
-	destroy_landuse_defaults(
-		world[0].defaults[0].num_landuse_default_files,
-		command_line[0].grow_flag,
+		world[0].defaults[0].soil);
+	destroy_landuse_defaults(
+		world[0].defaults[0].num_landuse_default_files,
+		command_line[0].grow_flag,
 		world[0].defaults[0].landuse);
 	if (command_line[0].surface_energy_flag == 1)
-		destroy_surface_energy_defaults(
-		world[0].defaults[0].num_surface_energy_default_files,
-		command_line[0].grow_flag,
+		destroy_surface_energy_defaults(
+		world[0].defaults[0].num_surface_energy_default_files,
+		command_line[0].grow_flag,
 		world[0].defaults[0].surface_energy);
 	if (command_line[0].firespread_flag == 1)
-		destroy_fire_defaults(
-		world[0].defaults[0].num_fire_default_files,
-		command_line[0].grow_flag,
+		destroy_fire_defaults(
+		world[0].defaults[0].num_fire_default_files,
+		command_line[0].grow_flag,
 		world[0].defaults[0].fire);
 	/*--------------------------------------------------------------*/
 	/*	Destroy the stratum_defaults objects.					*/
@@ -149,6 +149,14 @@ void destroy_world(struct command_line_object *command_line,
 	if (command_line[0].firespread_flag == 1)
 		free(world[0].fire_grid);
 	/*--------------------------------------------------------------*/
+	/*	Destroy the sparse redefine index if one was built.		*/
+	/*--------------------------------------------------------------*/
+	if (world[0].redefine_index != NULL){
+		for (i=0; i<SCHEMA_NUM_LEVELS; i++)
+			free(world[0].redefine_index[0].entries[i]);
+		free(world[0].redefine_index);
+	}
+	/*--------------------------------------------------------------*/
 	/*	Destroy the world.											*/
 	/*--------------------------------------------------------------*/
 	free( world );
@@ -0,0 +1,225 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					fork_ensemble_members						*/
+/*																*/
+/*	fork_ensemble_members - runs each member of an ensemble		*/
+/*			in its own child process							*/
+/*																*/
+/*	NAME														*/
+/*	fork_ensemble_members - runs each member of an ensemble		*/
+/*			in its own child process							*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	void fork_ensemble_members(									*/
+/*					struct	command_line_object	*command_line)	*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Called by construct_world once everything that does not	*/
+/*	depend on the sensitivity multipliers (the world header,	*/
+/*	default file lists and base station climate) has been		*/
+/*	read.  Forks one child per member of the -ensemble table,	*/
+/*	at most command_line.ensemble_jobs at a time (default the	*/
+/*	number of online processors).  In the child the member's	*/
+/*	multipliers are copied into the								*/
+/*	command line, the output prefix becomes <prefix>_<label>,	*/
+/*	stdout goes to <prefix>_<label>.log, and the function		*/
+/*	returns so the child goes on to build its own defaults,		*/
+/*	patches and routing and run the simulation.					*/
+/*																*/
+/*	The parent does not return: it waits for all members and	*/
+/*	exits, with failure if any member failed.					*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*	The climate is shared copy-on-write between the members.	*/
+/*	The defaults and the worldfile are read again by each		*/
+/*	member because construct_patch, construct_hillslope and	*/
+/*	construct_routing_topology derive state (transmissivity		*/
+/*	gamma, soil intervals, field capacity, hillslope means)		*/
+/*	from the multiplied defaults; reapplying multipliers to a	*/
+/*	constructed world would not reproduce a single run.			*/
+/*	Output of each member is identical to a separate run with	*/
+/*	the same options.											*/
+/*																*/
+/*	Checkpoint and redefine files are named from the world		*/
+/*	file, so output_checkpoint events should not be used in		*/
+/*	an ensemble run.											*/
+/*																*/
+/*--------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200112L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include "rhessys.h"
+
+static void apply_ensemble_member(struct command_line_object *command_line,
+								  struct ensemble_object *ensemble,
+								  int m)
+{
+	int	j;
+	double	value;
+
+	for (j=0; j < ensemble[0].num_columns; j++){
+		value = ensemble[0].values[m][j];
+		switch (ensemble[0].columns[j]){
+		case ENSEMBLE_S_M:
+			command_line[0].sen_flag = 1;
+			command_line[0].sen[M] = value;
+			break;
+		case ENSEMBLE_S_K:
+			command_line[0].sen_flag = 1;
+			command_line[0].sen[K] = value;
+			break;
+		case ENSEMBLE_S_SOIL_DEPTH:
+			command_line[0].sen_flag = 1;
+			command_line[0].sen[SOIL_DEPTH] = value;
+			break;
+		case ENSEMBLE_SV_M:
+			command_line[0].vsen_flag = 1;
+			command_line[0].vsen[M] = value;
+			break;
+		case ENSEMBLE_SV_K:
+			command_line[0].vsen_flag = 1;
+			command_line[0].vsen[K] = value;
+			break;
+		case ENSEMBLE_SVALT_PA:
+			command_line[0].vsen_alt_flag = 1;
+			command_line[0].vsen_alt[PA] = value;
+			break;
+		case ENSEMBLE_SVALT_PO:
+			command_line[0].vsen_alt_flag = 1;
+			command_line[0].vsen_alt[PO] = value;
+			break;
+		case ENSEMBLE_GW_SAT_TO_GW:
+			command_line[0].sat_to_gw_coeff_mult = value;
+			break;
+		case ENSEMBLE_GW_LOSS:
+			command_line[0].gw_loss_coeff_mult = value;
+			break;
+		case ENSEMBLE_VGSEN_1:
+			command_line[0].vgsen_flag = 1;
+			command_line[0].veg_sen1 = value;
+			break;
+		case ENSEMBLE_VGSEN_2:
+			command_line[0].vgsen_flag = 1;
+			command_line[0].veg_sen2 = value;
+			break;
+		case ENSEMBLE_VGSEN_3:
+			command_line[0].vgsen_flag = 1;
+			command_line[0].veg_sen3 = value;
+			break;
+		}
+	}
+	return;
+}
+
+void	fork_ensemble_members(struct command_line_object *command_line)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local function definition.									*/
+	/*--------------------------------------------------------------*/
+	void	*alloc( size_t, char *, char * );
+	struct	ensemble_object	*construct_ensemble( char *);
+
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	int	j, m, running, finished, num_failed, status;
+	pid_t	pid;
+	pid_t	*pids;
+	char	*prefix;
+	char	logname[MAXSTR];
+	struct	ensemble_object	*ensemble;
+
+	ensemble = construct_ensemble(command_line[0].ensemble_filename);
+	for (j=0; j < ensemble[0].num_columns; j++){
+		if ( ((ensemble[0].columns[j] == ENSEMBLE_GW_SAT_TO_GW)
+			|| (ensemble[0].columns[j] == ENSEMBLE_GW_LOSS))
+			&& (command_line[0].gw_flag == 0) ){
+			fprintf(stderr,
+				"FATAL ERROR: ensemble table %s sets groundwater multipliers but -gw was not given\n",
+				command_line[0].ensemble_filename);
+			exit(EXIT_FAILURE);
+		}
+	}
+	if (command_line[0].ensemble_jobs <= 0)
+		command_line[0].ensemble_jobs = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	if (command_line[0].ensemble_jobs <= 0)
+		command_line[0].ensemble_jobs = 1;
+	pids = (pid_t *) alloc(ensemble[0].num_members * sizeof(pid_t),
+		"pids","fork_ensemble_members");
+	printf("\n Running %d ensemble members, %d at a time\n",
+		ensemble[0].num_members, command_line[0].ensemble_jobs);
+
+	running = 0;
+	finished = 0;
+	num_failed = 0;
+	for (m=0; m <= ensemble[0].num_members; m++){
+		/*--------------------------------------------------------------*/
+		/*	wait for a free slot (or, after the last fork, for all)		*/
+		/*--------------------------------------------------------------*/
+		while ( (running > 0) && ((running >= command_line[0].ensemble_jobs)
+			|| (m == ensemble[0].num_members)) ){
+			if ( (pid = wait(&status)) < 0 ){
+				perror("fork_ensemble_members: wait");
+				exit(EXIT_FAILURE);
+			}
+			running--;
+			finished++;
+			for (j=0; j < m; j++)
+				if (pids[j] == pid)
+					break;
+			if ( !WIFEXITED(status) || (WEXITSTATUS(status) != EXIT_SUCCESS) ){
+				num_failed++;
+				fprintf(stderr,"ensemble member %s failed\n",
+					(j < m) ? ensemble[0].labels[j] : "?");
+			}
+			printf("\n Ensemble member %s finished (%d of %d)",
+				(j < m) ? ensemble[0].labels[j] : "?",
+				finished, ensemble[0].num_members);
+			fflush(stdout);
+		}
+		if (m == ensemble[0].num_members)
+			break;
+		/*--------------------------------------------------------------*/
+		/*	flush so buffered output is not repeated by the child		*/
+		/*--------------------------------------------------------------*/
+		fflush(stdout);
+		fflush(stderr);
+		if ( (pid = fork()) < 0 ){
+			perror("fork_ensemble_members: fork");
+			exit(EXIT_FAILURE);
+		}
+		if (pid == 0){
+			apply_ensemble_member(command_line, ensemble, m);
+			prefix = (char *) alloc(MAXSTR * sizeof(char),
+				"prefix","fork_ensemble_members");
+			snprintf(prefix, MAXSTR, "%s_%s",
+				(command_line[0].output_prefix != NULL) ?
+				command_line[0].output_prefix : PRE,
+				ensemble[0].labels[m]);
+			command_line[0].output_prefix = prefix;
+			snprintf(logname, MAXSTR, "%s.log", prefix);
+			if ( freopen(logname, "w", stdout) == NULL ){
+				fprintf(stderr,"FATAL ERROR: Unable to open ensemble log %s\n",
+					logname);
+				exit(EXIT_FAILURE);
+			}
+			printf("Ensemble member %s of %s\n", ensemble[0].labels[m],
+				command_line[0].ensemble_filename);
+			free(pids);
+			return;
+		}
+		pids[m] = pid;
+		running++;
+	}
+	printf("\n %d of %d ensemble members completed\n",
+		ensemble[0].num_members - num_failed, ensemble[0].num_members);
+	exit( (num_failed > 0) ? EXIT_FAILURE : EXIT_SUCCESS );
+} /*end fork_ensemble_members*/
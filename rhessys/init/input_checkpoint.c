@@ -0,0 +1,411 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					input_checkpoint							*/
+/*																*/
+/*	input_checkpoint - restores world state from a checkpoint	*/
+/*																*/
+/*	NAME														*/
+/*	input_checkpoint - restores world state from a checkpoint	*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	long	input_checkpoint(									*/
+/*					struct	world_object	*world,				*/
+/*					struct	command_line_object *command_line,	*/
+/*					struct	date	*current_date,				*/
+/*					struct	date	*next_date)					*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Reads a file written by execute_checkpoint_event (-restart)	*/
+/*	over a world constructed from the same inputs.  Each		*/
+/*	object struct is read in place and its pointer members		*/
+/*	are put back from the constructed world.  Sets the			*/
+/*	simulation dates and output flags from the header and		*/
+/*	returns the tec file position to resume from.				*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*	The walk order must match execute_checkpoint_event.			*/
+/*	Object IDs are checked as the file is read so a checkpoint	*/
+/*	from a different world is rejected rather than misread.		*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rhessys.h"
+
+static void read_checkpoint_block(FILE *infile, void *block, size_t size,
+								  char *filename)
+{
+	if ( (size > 0) && (fread(block, size, 1, infile) != 1) ){
+		fprintf(stderr,"FATAL ERROR: checkpoint file %s is truncated\n",
+			filename);
+		exit(EXIT_FAILURE);
+	}
+}
+
+static int read_checkpoint_index(FILE *infile, int num_defaults, char *name,
+								 char *filename)
+{
+	int	index;
+
+	read_checkpoint_block(infile, &index, sizeof(int), filename);
+	if ( (index < 0) || (index >= num_defaults) ){
+		fprintf(stderr,"FATAL ERROR: checkpoint file %s has bad %s default index %d\n",
+			filename, name, index);
+		exit(EXIT_FAILURE);
+	}
+	return(index);
+}
+
+static void check_checkpoint_ID(int ID, int expected, char *name,
+								char *filename)
+{
+	if (ID != expected){
+		fprintf(stderr,"FATAL ERROR: checkpoint file %s has %s %d where the world has %d\n",
+			filename, name, ID, expected);
+		exit(EXIT_FAILURE);
+	}
+}
+
+static void restore_patch_pointers(struct patch_object *patch,
+								   struct patch_object *live_patch)
+{
+	patch[0].base_stations = live_patch[0].base_stations;
+	patch[0].soil_defaults = live_patch[0].soil_defaults;
+	patch[0].landuse_defaults = live_patch[0].landuse_defaults;
+	patch[0].fire_defaults = live_patch[0].fire_defaults;
+	patch[0].surface_energy_defaults =
+		live_patch[0].surface_energy_defaults;
+	patch[0].grow = live_patch[0].grow;
+	patch[0].canopy_strata = live_patch[0].canopy_strata;
+	patch[0].hourly = live_patch[0].hourly;
+	patch[0].layers = live_patch[0].layers;
+	patch[0].innundation_list = live_patch[0].innundation_list;
+	patch[0].surface_innundation_list =
+		live_patch[0].surface_innundation_list;
+	patch[0].neighbours = live_patch[0].neighbours;
+	patch[0].next_stream = live_patch[0].next_stream;
+	patch[0].surface_energy_profile =
+		live_patch[0].surface_energy_profile;
+	patch[0].zone = live_patch[0].zone;
+	patch[0].transmissivity_profile =
+		live_patch[0].transmissivity_profile;
+	patch[0].smoothed_transmissivity_profile =
+		live_patch[0].smoothed_transmissivity_profile;
+	patch[0].smoothed_transmissivity_std =
+		live_patch[0].smoothed_transmissivity_std;
+	patch[0].num_smoothed_intervals = live_patch[0].num_smoothed_intervals;
+}
+
+long	input_checkpoint(
+						 struct	world_object	*world,
+						 struct	command_line_object *command_line,
+						 struct	date	*current_date,
+						 struct	date	*next_date)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local function definition.									*/
+	/*--------------------------------------------------------------*/
+	void	*alloc( size_t, char *, char * );
+	int	cal_date_lt( struct date, struct date );
+	long	julday( struct date );
+
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	int	b, h, z, p, c, i;
+	int	index[5];
+	char	*filename;
+	FILE	*infile;
+	struct	checkpoint_header	header;
+	struct	default_object	*defaults;
+	struct	basin_grow_default	*basin_grow_defaults;
+	struct	zone_grow_default	*zone_grow_defaults;
+	struct	basin_object	*basin, live_basin;
+	struct	hillslope_object	*hillslope, live_hillslope;
+	struct	zone_object	*zone, live_zone;
+	struct	patch_object	*patch, live_patch;
+	struct	canopy_strata_object	*stratum, live_stratum;
+	struct	stream_network_object	*reach, live_reach;
+	struct	base_station_object	*base_station;
+
+	filename = command_line[0].restart_filename;
+	if ( ( infile = fopen(filename, "rb")) == NULL ){
+		fprintf(stderr,"FATAL ERROR: Unable to open checkpoint file %s\n",
+			filename);
+		exit(EXIT_FAILURE);
+	}
+	/*--------------------------------------------------------------*/
+	/*	header														*/
+	/*--------------------------------------------------------------*/
+	read_checkpoint_block(infile, &header, sizeof(struct checkpoint_header),
+		filename);
+	if ( (strcmp(header.magic, CHECKPOINT_MAGIC) != 0)
+		|| (header.version != CHECKPOINT_VERSION) ){
+		fprintf(stderr,"FATAL ERROR: %s is not a checkpoint file\n", filename);
+		exit(EXIT_FAILURE);
+	}
+	if ( (header.struct_sizes[0] != sizeof(struct world_object))
+		|| (header.struct_sizes[1] != sizeof(struct basin_object))
+		|| (header.struct_sizes[2] != sizeof(struct hillslope_object))
+		|| (header.struct_sizes[3] != sizeof(struct zone_object))
+		|| (header.struct_sizes[4] != sizeof(struct patch_object))
+		|| (header.struct_sizes[5] != sizeof(struct canopy_strata_object)) ){
+		fprintf(stderr,"FATAL ERROR: checkpoint file %s was written by a different build\n",
+			filename);
+		exit(EXIT_FAILURE);
+	}
+	check_checkpoint_ID(header.num_basins, world[0].num_basin_files,
+		"num_basins", filename);
+	if ( (julday(header.current_date) < julday(world[0].start_date))
+		|| (cal_date_lt(header.current_date, world[0].end_date) == 0) ){
+		fprintf(stderr,"FATAL ERROR: checkpoint date %ld %ld %ld is outside the simulation period\n",
+			header.current_date.year, header.current_date.month,
+			header.current_date.day);
+		exit(EXIT_FAILURE);
+	}
+	*current_date = header.current_date;
+	*next_date = header.next_date;
+	command_line[0].output_flags = header.output_flags;
+	command_line[0].output_yearly_date = header.output_yearly_date;
+	if (command_line[0].seed_flag == 0){
+		command_line[0].seed = header.seed;
+		if (command_line[0].precip_scale_flag == 1)
+			printf("\n Random seed %lu from the checkpoint\n", command_line[0].seed);
+	}
+	/*--------------------------------------------------------------*/
+	/*	world														*/
+	/*--------------------------------------------------------------*/
+	read_checkpoint_block(infile, &(world[0].year_day), sizeof(int), filename);
+	read_checkpoint_block(infile, &(world[0].declin), sizeof(double), filename);
+	read_checkpoint_block(infile, &(world[0].cos_declin), sizeof(double), filename);
+	read_checkpoint_block(infile, &(world[0].sin_declin), sizeof(double), filename);
+	read_checkpoint_block(infile, &(world[0].Io), sizeof(double), filename);
+	/*--------------------------------------------------------------*/
+	/*	defaults - keep the grow default pointers					*/
+	/*--------------------------------------------------------------*/
+	defaults = world[0].defaults;
+	for (i=0; i < defaults[0].num_basin_default_files; i++){
+		basin_grow_defaults = defaults[0].basin[i].grow_defaults;
+		read_checkpoint_block(infile, &(defaults[0].basin[i]),
+			sizeof(struct basin_default), filename);
+		defaults[0].basin[i].grow_defaults = basin_grow_defaults;
+	}
+	read_checkpoint_block(infile, defaults[0].hillslope,
+		defaults[0].num_hillslope_default_files * sizeof(struct hillslope_default),
+		filename);
+	for (i=0; i < defaults[0].num_zone_default_files; i++){
+		zone_grow_defaults = defaults[0].zone[i].grow_defaults;
+		read_checkpoint_block(infile, &(defaults[0].zone[i]),
+			sizeof(struct zone_default), filename);
+		defaults[0].zone[i].grow_defaults = zone_grow_defaults;
+	}
+	read_checkpoint_block(infile, defaults[0].soil,
+		defaults[0].num_soil_default_files * sizeof(struct soil_default),
+		filename);
+	read_checkpoint_block(infile, defaults[0].landuse,
+		defaults[0].num_landuse_default_files * sizeof(struct landuse_default),
+		filename);
+	read_checkpoint_block(infile, defaults[0].stratum,
+		defaults[0].num_stratum_default_files * sizeof(struct stratum_default),
+		filename);
+	if (command_line[0].firespread_flag == 1)
+		read_checkpoint_block(infile, defaults[0].fire,
+			defaults[0].num_fire_default_files * sizeof(struct fire_default),
+			filename);
+	if (command_line[0].surface_energy_flag == 1)
+		read_checkpoint_block(infile, defaults[0].surface_energy,
+			defaults[0].num_surface_energy_default_files
+			* sizeof(struct surface_energy_default), filename);
+	/*--------------------------------------------------------------*/
+	/*	basins														*/
+	/*--------------------------------------------------------------*/
+	for (b=0; b < world[0].num_basin_files; b++){
+		basin = world[0].basins[b];
+		live_basin = *basin;
+		read_checkpoint_block(infile, basin, sizeof(struct basin_object),
+			filename);
+		check_checkpoint_ID(basin[0].ID, live_basin.ID, "basin", filename);
+		basin[0].base_stations = live_basin.base_stations;
+		basin[0].defaults = live_basin.defaults;
+		basin[0].hourly = live_basin.hourly;
+		basin[0].ephemeris = live_basin.ephemeris;
+		basin[0].grow = live_basin.grow;
+		basin[0].hillslopes = live_basin.hillslopes;
+		basin[0].outside_region = live_basin.outside_region;
+		basin[0].stream_list.stream_network = live_basin.stream_list.stream_network;
+		basin[0].route_list = live_basin.route_list;
+		basin[0].surface_route_list = live_basin.surface_route_list;
+		basin[0].defaults[0] = &(defaults[0].basin[read_checkpoint_index(infile,
+			defaults[0].num_basin_default_files, "basin", filename)]);
+		if ( (command_line[0].grow_flag > 0) && (basin[0].grow != NULL) )
+			read_checkpoint_block(infile, basin[0].grow,
+				sizeof(struct grow_basin_object), filename);
+		if (command_line[0].routing_flag == 1){
+			live_patch = *(basin[0].outside_region);
+			read_checkpoint_block(infile, basin[0].outside_region,
+				sizeof(struct patch_object), filename);
+			restore_patch_pointers(basin[0].outside_region, &live_patch);
+		}
+		if (command_line[0].stream_routing_flag == 1){
+			check_checkpoint_ID(basin[0].stream_list.num_reaches,
+				live_basin.stream_list.num_reaches, "num_reaches", filename);
+			for (i=0; i < basin[0].stream_list.num_reaches; i++){
+				reach = &(basin[0].stream_list.stream_network[i]);
+				live_reach = *reach;
+				read_checkpoint_block(infile, reach,
+					sizeof(struct stream_network_object), filename);
+				check_checkpoint_ID(reach[0].reach_ID, live_reach.reach_ID,
+					"reach", filename);
+				reach[0].downstream_neighbours = live_reach.downstream_neighbours;
+				reach[0].upstream_neighbours = live_reach.upstream_neighbours;
+				reach[0].lateral_inputs = live_reach.lateral_inputs;
+				reach[0].neighbour_hill = live_reach.neighbour_hill;
+			}
+		}
+		/*--------------------------------------------------------------*/
+		/*	hillslopes													*/
+		/*--------------------------------------------------------------*/
+		for (h=0; h < basin[0].num_hillslopes; h++){
+			hillslope = basin[0].hillslopes[h];
+			live_hillslope = *hillslope;
+			read_checkpoint_block(infile, hillslope,
+				sizeof(struct hillslope_object), filename);
+			check_checkpoint_ID(hillslope[0].ID, live_hillslope.ID,
+				"hillslope", filename);
+			hillslope[0].base_stations = live_hillslope.base_stations;
+			hillslope[0].grow = live_hillslope.grow;
+			hillslope[0].defaults = live_hillslope.defaults;
+			hillslope[0].hourly = live_hillslope.hourly;
+			hillslope[0].routing_order = live_hillslope.routing_order;
+			hillslope[0].zones = live_hillslope.zones;
+			hillslope[0].defaults[0] = &(defaults[0].hillslope[
+				read_checkpoint_index(infile,
+				defaults[0].num_hillslope_default_files, "hillslope", filename)]);
+			if ( (command_line[0].grow_flag > 0) && (hillslope[0].grow != NULL) )
+				read_checkpoint_block(infile, hillslope[0].grow,
+					sizeof(struct grow_hillslope_object), filename);
+			/*--------------------------------------------------------------*/
+			/*	zones														*/
+			/*--------------------------------------------------------------*/
+			for (z=0; z < hillslope[0].num_zones; z++){
+				zone = hillslope[0].zones[z];
+				live_zone = *zone;
+				read_checkpoint_block(infile, zone, sizeof(struct zone_object),
+					filename);
+				check_checkpoint_ID(zone[0].ID, live_zone.ID, "zone", filename);
+				zone[0].base_stations = live_zone.base_stations;
+				zone[0].grow = live_zone.grow;
+				zone[0].patches = live_zone.patches;
+				zone[0].defaults = live_zone.defaults;
+				zone[0].hourly = live_zone.hourly;
+				read_checkpoint_block(infile, zone[0].hourly,
+					sizeof(struct zone_hourly_object), filename);
+				zone[0].defaults[0] = &(defaults[0].zone[read_checkpoint_index(
+					infile, defaults[0].num_zone_default_files, "zone", filename)]);
+				if (zone[0].base_stations != NULL){
+					base_station = zone[0].base_stations[0];
+					read_checkpoint_block(infile, index, 2 * sizeof(int), filename);
+					base_station[0].hourly_clim[0].rain.inx = index[0];
+					base_station[0].hourly_clim[0].rain_duration.inx = index[1];
+				}
+				/*--------------------------------------------------------------*/
+				/*	patches														*/
+				/*--------------------------------------------------------------*/
+				for (p=0; p < zone[0].num_patches; p++){
+					patch = zone[0].patches[p];
+					live_patch = *patch;
+					for (i=0; i < live_patch.num_layers; i++)
+						free(live_patch.layers[i].strata);
+					read_checkpoint_block(infile, patch,
+						sizeof(struct patch_object), filename);
+					check_checkpoint_ID(patch[0].ID, live_patch.ID, "patch",
+						filename);
+					restore_patch_pointers(patch, &live_patch);
+					read_checkpoint_block(infile, patch[0].hourly,
+						sizeof(struct patch_hourly_object), filename);
+					patch[0].soil_defaults[0] = &(defaults[0].soil[
+						read_checkpoint_index(infile,
+						defaults[0].num_soil_default_files, "soil", filename)]);
+					patch[0].landuse_defaults[0] = &(defaults[0].landuse[
+						read_checkpoint_index(infile,
+						defaults[0].num_landuse_default_files, "landuse", filename)]);
+					if (command_line[0].firespread_flag == 1)
+						patch[0].fire_defaults[0] = &(defaults[0].fire[
+							read_checkpoint_index(infile,
+							defaults[0].num_fire_default_files, "fire", filename)]);
+					else
+						read_checkpoint_block(infile, index, sizeof(int), filename);
+					if (command_line[0].surface_energy_flag == 1)
+						patch[0].surface_energy_defaults[0] =
+							&(defaults[0].surface_energy[read_checkpoint_index(
+							infile, defaults[0].num_surface_energy_default_files,
+							"surface_energy", filename)]);
+					else
+						read_checkpoint_block(infile, index, sizeof(int), filename);
+					if (patch[0].base_stations != NULL){
+						base_station = patch[0].base_stations[0];
+						read_checkpoint_block(infile, index, 5 * sizeof(int),
+							filename);
+						base_station[0].dated_input[0].fertilizer_NO3.inx = index[0];
+						base_station[0].dated_input[0].fertilizer_NH4.inx = index[1];
+						base_station[0].dated_input[0].irrigation.inx = index[2];
+						base_station[0].dated_input[0].PH.inx = index[3];
+						base_station[0].dated_input[0].grazing_Closs.inx = index[4];
+					}
+					if (command_line[0].surface_energy_flag == 1)
+						read_checkpoint_block(infile,
+							patch[0].surface_energy_profile,
+							4 * sizeof(struct surface_energy_object), filename);
+					/*--------------------------------------------------------------*/
+					/*	canopy layers												*/
+					/*--------------------------------------------------------------*/
+					if ( (patch[0].num_layers < 0)
+						|| (patch[0].num_layers > patch[0].num_canopy_strata) ){
+						fprintf(stderr,"FATAL ERROR: checkpoint file %s has %d layers for patch %d\n",
+							filename, patch[0].num_layers, patch[0].ID);
+						exit(EXIT_FAILURE);
+					}
+					for (i=0; i < patch[0].num_layers; i++){
+						read_checkpoint_block(infile, &(patch[0].layers[i]),
+							sizeof(struct layer_object), filename);
+						patch[0].layers[i].strata = (long *)
+							alloc(patch[0].layers[i].count * sizeof(long),
+							"strata","input_checkpoint");
+						read_checkpoint_block(infile, patch[0].layers[i].strata,
+							patch[0].layers[i].count * sizeof(long), filename);
+					}
+					/*--------------------------------------------------------------*/
+					/*	strata														*/
+					/*--------------------------------------------------------------*/
+					for (c=0; c < patch[0].num_canopy_strata; c++){
+						stratum = patch[0].canopy_strata[c];
+						live_stratum = *stratum;
+						read_checkpoint_block(infile, stratum,
+							sizeof(struct canopy_strata_object), filename);
+						check_checkpoint_ID(stratum[0].ID, live_stratum.ID,
+							"stratum", filename);
+						stratum[0].base_stations = live_stratum.base_stations;
+						stratum[0].defaults = live_stratum.defaults;
+						stratum[0].hourly = live_stratum.hourly;
+						stratum[0].defaults[0] = &(defaults[0].stratum[
+							read_checkpoint_index(infile,
+							defaults[0].num_stratum_default_files, "stratum",
+							filename)]);
+					}
+				}
+			}
+		}
+	}
+	if (fgetc(infile) != EOF){
+		fprintf(stderr,"FATAL ERROR: checkpoint file %s does not match the world\n",
+			filename);
+		exit(EXIT_FAILURE);
+	}
+	fclose(infile);
+	return(header.tec_offset);
+} /*end input_checkpoint*/
@@ -0,0 +1,433 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					prune_world_to_outlet						*/
+/*																*/
+/*	prune_world_to_outlet - drops everything that does not		*/
+/*			drain to the -outlet patch							*/
+/*																*/
+/*	NAME														*/
+/*	prune_world_to_outlet - drops everything that does not		*/
+/*			drain to the -outlet patch							*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	void prune_world_to_outlet(									*/
+/*			struct	world_object	*world,						*/
+/*			struct	command_line_object	*command_line)			*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Called by construct_world once the basins and their			*/
+/*	routing topology are built.  The contributing area of the	*/
+/*	outlet patch is found from the flow table: a patch			*/
+/*	contributes if one of its subsurface or surface neighbours	*/
+/*	contributes, or, for a road, the stream it cuts into.  The	*/
+/*	outlet itself contributes, so for a stream patch the		*/
+/*	stream patches upslope of it in the flow table are kept.	*/
+/*																*/
+/*	All other patches are taken out of their zones and of the	*/
+/*	routing lists, zones and hillslopes left empty are taken	*/
+/*	out of their hillslopes and basin, and basins other than	*/
+/*	the outlet's are taken out of the world; all of them are	*/
+/*	freed.  Zone areas and hillslope means are recomputed		*/
+/*	over what is left, so the basin output is that of the		*/
+/*	contributing area alone and the simulation time scales		*/
+/*	with it.													*/
+/*																*/
+/*	The neighbour lists of kept patches are cut to kept			*/
+/*	patches (and the basin's outside_region), and the gammas	*/
+/*	of the kept neighbours are scaled up by the fraction that	*/
+/*	went to dropped ones, so no water is routed out of the		*/
+/*	simulation along a divide.  The outlet's own lists are		*/
+/*	cut but not rescaled: what it routes downslope is the		*/
+/*	outflow of the contributing area and leaves the world.		*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*	The contributing set is grown by sweeping the routing list	*/
+/*	from its end until nothing changes; flow tables list		*/
+/*	patches from the top down so this normally takes two		*/
+/*	sweeps.  Patches that drain partly to the outlet and partly	*/
+/*	elsewhere are kept and send all their outflow towards the	*/
+/*	outlet, so results along such divides (and so at the		*/
+/*	outlet) can differ slightly from the same patches in a run	*/
+/*	of the whole world.  A list left with no kept neighbour,	*/
+/*	or a kept road cutting into a dropped stream, cannot be		*/
+/*	rescaled; that flow leaves the simulation and the number	*/
+/*	of such lists is reported as a WARNING.  The dropped		*/
+/*	stream is then kept allocated (outlet_upstream 2), with		*/
+/*	its zone and hillslope, but not simulated.					*/
+/*	Dropped objects are still read from the world file, and		*/
+/*	are freed with dealloc under the tags they were allocated	*/
+/*	with, so the -memreport tallies stay right.  Stream reach	*/
+/*	routing (-str) has its own topology and is not pruned, so	*/
+/*	it cannot be combined with -outlet.							*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include "rhessys.h"
+
+static int drains_to_outlet(struct patch_object *patch, int surface)
+{
+	int	d, n;
+
+	for (d=0; d < patch[0].num_innundation_depths; d++)
+		for (n=0; n < patch[0].innundation_list[d].num_neighbours; n++)
+			if (patch[0].innundation_list[d].neighbours[n].patch[0].outlet_upstream == 1)
+				return(1);
+	if (surface == 1)
+		for (n=0; n < patch[0].surface_innundation_list[0].num_neighbours; n++)
+			if (patch[0].surface_innundation_list[0].neighbours[n].patch[0].outlet_upstream == 1)
+				return(1);
+	if ( (patch[0].drainage_type == ROAD) && (patch[0].next_stream != NULL)
+		&& (patch[0].next_stream[0].outlet_upstream == 1) )
+		return(1);
+	return(0);
+}
+
+static int prune_neighbours(struct innundation_object *list,
+							struct patch_object *outside_region,
+							int rescale)
+{
+	int	n, k;
+	double	kept, dropped;
+	struct	patch_object	*neigh;
+
+	k = 0;
+	kept = 0.0;
+	dropped = 0.0;
+	for (n=0; n < list[0].num_neighbours; n++){
+		neigh = list[0].neighbours[n].patch;
+		if ( (neigh == outside_region) || (neigh[0].outlet_upstream == 1) ){
+			if (neigh != outside_region)
+				kept += list[0].neighbours[n].gamma;
+			list[0].neighbours[k++] = list[0].neighbours[n];
+		}
+		else
+			dropped += list[0].neighbours[n].gamma;
+	}
+	list[0].num_neighbours = k;
+	if ( (rescale == 0) || (dropped <= 0.0) )
+		return(0);
+	if (kept <= 0.0)
+		return(1);
+	for (n=0; n < k; n++)
+		if (list[0].neighbours[n].patch != outside_region)
+			list[0].neighbours[n].gamma *= (kept + dropped) / kept;
+	return(0);
+}
+
+static void dealloc_innundation_list(struct innundation_object *list,
+									 int num_depths,
+									 char *name,
+									 char *caller)
+{
+	void	dealloc( void *, size_t, char *, char * );
+	int	d;
+
+	if (list == NULL)
+		return;
+	for (d=0; d < num_depths; d++)
+		dealloc(list[d].neighbours,
+			list[d].num_neighbours * sizeof(struct neighbour_object),
+			"neighbours", caller);
+	dealloc(list, num_depths * sizeof(struct innundation_object), name, caller);
+	return;
+}
+
+static void dealloc_patch(struct patch_object *patch, int ddn)
+{
+	void	dealloc( void *, size_t, char *, char * );
+	int	c, i;
+	struct	canopy_strata_object	*stratum;
+
+	for (c=0; c < patch[0].num_canopy_strata; c++){
+		stratum = patch[0].canopy_strata[c];
+		dealloc(stratum[0].base_stations,
+			stratum[0].num_base_stations * sizeof(struct base_station_object *),
+			"base_stations","construct_canopy_strata");
+		dealloc(stratum[0].defaults, sizeof(struct stratum_default *),
+			"defaults","construct_canopy_strata");
+		dealloc(stratum, sizeof(struct canopy_strata_object),
+			"canopy_strata","construct_canopy_strata");
+	}
+	dealloc(patch[0].canopy_strata,
+		patch[0].num_canopy_strata * sizeof(struct canopy_strata_object *),
+		"canopy_strata","construct_patch");
+	for (i=0; i < patch[0].num_layers; i++)
+		dealloc(patch[0].layers[i].strata,
+			patch[0].layers[i].count * sizeof(long),
+			"patch[0].layers[i].strata","construct_patch");
+	dealloc(patch[0].layers,
+		patch[0].num_canopy_strata * sizeof(struct layer_object),
+		"layers","construct_patch");
+	dealloc(patch[0].base_stations,
+		patch[0].num_base_stations * sizeof(struct base_station_object *),
+		"base_stations","construct_patch");
+	dealloc(patch[0].soil_defaults, sizeof(struct soil_default *),
+		"defaults","construct_patch");
+	dealloc(patch[0].landuse_defaults, sizeof(struct landuse_default *),
+		"defaults","construct_patch");
+	dealloc(patch[0].fire_defaults, sizeof(struct fire_default *),
+		"defaults","construct_patch");
+	dealloc(patch[0].surface_energy_defaults,
+		sizeof(struct surface_energy_default *),
+		"defaults","construct_patch");
+	dealloc(patch[0].surface_energy_profile,
+		4 * sizeof(struct surface_energy_object),
+		"energy_object","construct_patch");
+	free(patch[0].hourly);
+	if (ddn == 1)
+		dealloc_innundation_list(patch[0].innundation_list,
+			patch[0].num_innundation_depths,
+			"innundation_list","assign_neighbours");
+	else {
+		dealloc_innundation_list(patch[0].innundation_list, 1,
+			"innundation_list","construct_routing_topology");
+		dealloc_innundation_list(patch[0].surface_innundation_list, 1,
+			"surface_innundation_list","construct_routing_topology");
+	}
+	dealloc(patch[0].transmissivity_profile,
+		(patch[0].num_soil_intervals+1) * sizeof(double),
+		"trans","compute_transmissivity_cuve");
+	dealloc(patch[0].smoothed_transmissivity_profile,
+		(patch[0].num_smoothed_intervals+1) * sizeof(double),
+		"smoothed_trans","compute_smoothed_transmissivity");
+	dealloc(patch, sizeof(struct patch_object), "patch","construct_patch");
+	return;
+}
+
+static void dealloc_zone(struct zone_object *zone)
+{
+	void	dealloc( void *, size_t, char *, char * );
+
+	dealloc(zone[0].patches, zone[0].num_patches * sizeof(struct patch_object *),
+		"patches","construct_zone");
+	dealloc(zone[0].base_stations,
+		zone[0].num_base_stations * sizeof(struct base_station_object *),
+		"base_stations","construct_zone");
+	dealloc(zone[0].defaults, sizeof(struct zone_default *),
+		"defaults","construct_zone");
+	dealloc(zone[0].hourly, sizeof(struct zone_hourly_object),
+		"hourly","zone_hourly");
+	dealloc(zone, sizeof(struct zone_object), "zone","construct_zone");
+	return;
+}
+
+static void dealloc_hillslope(struct hillslope_object *hillslope)
+{
+	void	dealloc( void *, size_t, char *, char * );
+
+	dealloc(hillslope[0].zones,
+		hillslope[0].num_zones * sizeof(struct zone_object *),
+		"zones","construct_hillslopes");
+	dealloc(hillslope[0].base_stations,
+		hillslope[0].num_base_stations * sizeof(struct base_station_object *),
+		"base_stations","construct_hillslopes");
+	dealloc(hillslope[0].defaults, sizeof(struct hillslope_default *),
+		"defaults","construct_hillslopes");
+	dealloc(hillslope[0].grow, sizeof(struct grow_hillslope_object),
+		"grow","construct_hillslope");
+	dealloc(hillslope, sizeof(struct hillslope_object),
+		"hillslope","construct_hillsope");
+	return;
+}
+
+static void prune_route_list(struct routing_list_object *route_list)
+{
+	int	i, k;
+
+	k = 0;
+	for (i=0; i < route_list[0].num_patches; i++)
+		if (route_list[0].list[i][0].outlet_upstream == 1)
+			route_list[0].list[k++] = route_list[0].list[i];
+	route_list[0].num_patches = k;
+	return;
+}
+
+void	prune_world_to_outlet(
+							  struct	world_object	*world,
+							  struct	command_line_object	*command_line)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local function definition.									*/
+	/*--------------------------------------------------------------*/
+	void	compute_mean_hillslope_parameters( struct hillslope_object *);
+
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	int	b, h, z, p, i, d, hk, zk, pk, changed, surface, ddn;
+	int	num_patches, num_kept, num_lost, retained, zone_retained;
+	double	area;
+	struct	basin_object	*basin;
+	struct	hillslope_object	*hillslope;
+	struct	zone_object	*zone;
+	struct	patch_object	*patch;
+	struct	patch_object	*outlet;
+
+	if (command_line[0].routing_flag == 0){
+		fprintf(stderr,"FATAL ERROR: -outlet needs a flow table (-r)\n");
+		exit(EXIT_FAILURE);
+	}
+	if (command_line[0].stream_routing_flag == 1){
+		fprintf(stderr,"FATAL ERROR: -outlet cannot be used with stream routing (-str)\n");
+		exit(EXIT_FAILURE);
+	}
+	/*--------------------------------------------------------------*/
+	/*	find the outlet and clear the marks							*/
+	/*--------------------------------------------------------------*/
+	outlet = NULL;
+	basin = NULL;
+	for (b=0; b < world[0].num_basin_files; b++){
+		for (i=0; i < world[0].basins[b][0].route_list[0].num_patches; i++)
+			world[0].basins[b][0].route_list[0].list[i][0].outlet_upstream = 0;
+		for (h=0; h < world[0].basins[b][0].num_hillslopes; h++){
+			hillslope = world[0].basins[b][0].hillslopes[h];
+			for (z=0; z < hillslope[0].num_zones; z++){
+				zone = hillslope[0].zones[z];
+				for (p=0; p < zone[0].num_patches; p++){
+					patch = zone[0].patches[p];
+					patch[0].outlet_upstream = 0;
+					if ( (patch[0].ID == command_line[0].outlet_ID[0])
+						&& (zone[0].ID == command_line[0].outlet_ID[1])
+						&& (hillslope[0].ID == command_line[0].outlet_ID[2]) ){
+						outlet = patch;
+						basin = world[0].basins[b];
+					}
+				}
+			}
+		}
+	}
+	if (outlet == NULL){
+		fprintf(stderr,"FATAL ERROR: -outlet patch %d zone %d hillslope %d not found\n",
+			command_line[0].outlet_ID[0], command_line[0].outlet_ID[1],
+			command_line[0].outlet_ID[2]);
+		exit(EXIT_FAILURE);
+	}
+	/*--------------------------------------------------------------*/
+	/*	grow the contributing set up the flow table					*/
+	/*--------------------------------------------------------------*/
+	surface = (command_line[0].ddn_routing_flag == 0);
+	outlet[0].outlet_upstream = 1;
+	do {
+		changed = 0;
+		for (i=basin[0].route_list[0].num_patches-1; i >= 0; i--){
+			patch = basin[0].route_list[0].list[i];
+			if ( (patch[0].outlet_upstream == 0)
+				&& (drains_to_outlet(patch, surface) == 1) ){
+				patch[0].outlet_upstream = 1;
+				changed = 1;
+			}
+		}
+	} while (changed == 1);
+	/*--------------------------------------------------------------*/
+	/*	cut the neighbour lists of kept patches to the kept set		*/
+	/*--------------------------------------------------------------*/
+	ddn = command_line[0].ddn_routing_flag;
+	num_lost = 0;
+	for (i=0; i < basin[0].route_list[0].num_patches; i++){
+		patch = basin[0].route_list[0].list[i];
+		if (patch[0].outlet_upstream != 1)
+			continue;
+		if (patch[0].innundation_list != NULL)
+			for (d=0; d < patch[0].num_innundation_depths; d++)
+				num_lost += prune_neighbours(&(patch[0].innundation_list[d]),
+					basin[0].outside_region, (patch != outlet));
+		if ( (surface == 1) && (patch[0].surface_innundation_list != NULL) )
+			num_lost += prune_neighbours(patch[0].surface_innundation_list,
+				basin[0].outside_region, (patch != outlet));
+		if ( (patch[0].drainage_type == ROAD) && (patch[0].next_stream != NULL)
+			&& (patch[0].next_stream[0].outlet_upstream != 1) ){
+			patch[0].next_stream[0].outlet_upstream = 2;
+			num_lost += 1;
+		}
+	}
+	/*--------------------------------------------------------------*/
+	/*	drop what does not contribute								*/
+	/*--------------------------------------------------------------*/
+	prune_route_list(basin[0].route_list);
+	if (surface == 1)
+		prune_route_list(basin[0].surface_route_list);
+	num_patches = 0;
+	num_kept = 0;
+	hk = 0;
+	for (h=0; h < basin[0].num_hillslopes; h++){
+		hillslope = basin[0].hillslopes[h];
+		zk = 0;
+		zone_retained = 0;
+		for (z=0; z < hillslope[0].num_zones; z++){
+			zone = hillslope[0].zones[z];
+			pk = 0;
+			area = 0.0;
+			retained = 0;
+			for (p=0; p < zone[0].num_patches; p++){
+				patch = zone[0].patches[p];
+				if (patch[0].outlet_upstream == 1){
+					zone[0].patches[pk++] = patch;
+					area += patch[0].area;
+				}
+				else if (patch[0].outlet_upstream == 2)
+					retained = 1;
+				else
+					dealloc_patch(patch, ddn);
+			}
+			num_patches += zone[0].num_patches;
+			num_kept += pk;
+			if (pk == 0){
+				if (retained == 0)
+					dealloc_zone(zone);
+				else
+					zone_retained = 1;
+				continue;
+			}
+			if (pk < zone[0].num_patches){
+				zone[0].num_patches = pk;
+				zone[0].area = area;
+			}
+			hillslope[0].zones[zk++] = zone;
+		}
+		if (zk == 0){
+			if (zone_retained == 0)
+				dealloc_hillslope(hillslope);
+			continue;
+		}
+		hillslope[0].num_zones = zk;
+		compute_mean_hillslope_parameters(hillslope);
+		basin[0].hillslopes[hk++] = hillslope;
+	}
+	basin[0].num_hillslopes = hk;
+	basin[0].area = 0.0;
+	for (h=0; h < basin[0].num_hillslopes; h++)
+		basin[0].area += basin[0].hillslopes[h][0].area;
+	/*--------------------------------------------------------------*/
+	/*	free the other basins' hillslopes, zones and patches		*/
+	/*--------------------------------------------------------------*/
+	for (b=0; b < world[0].num_basin_files; b++){
+		if (world[0].basins[b] == basin)
+			continue;
+		for (h=0; h < world[0].basins[b][0].num_hillslopes; h++){
+			hillslope = world[0].basins[b][0].hillslopes[h];
+			for (z=0; z < hillslope[0].num_zones; z++){
+				zone = hillslope[0].zones[z];
+				for (p=0; p < zone[0].num_patches; p++)
+					dealloc_patch(zone[0].patches[p], ddn);
+				dealloc_zone(zone);
+			}
+			dealloc_hillslope(hillslope);
+		}
+		world[0].basins[b][0].num_hillslopes = 0;
+	}
+	world[0].basins[0] = basin;
+	world[0].num_basin_files = 1;
+	printf("\n Outlet patch %d zone %d hillslope %d: kept %d of %d patches of basin %d\n",
+		command_line[0].outlet_ID[0], command_line[0].outlet_ID[1],
+		command_line[0].outlet_ID[2], num_kept, num_patches, basin[0].ID);
+	if (num_lost > 0)
+		fprintf(stderr,
+			"WARNING: -outlet: %d neighbour lists or roads of kept patches drain only to dropped patches; that flow leaves the simulation\n",
+			num_lost);
+	return;
+} /*end prune_world_to_outlet*/
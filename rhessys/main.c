@@ -57,6 +57,35 @@
         -str    Streamflow routing option. Gives name of stream_table to define explicit streamflow routing connectivit.     
         -stro   Streamflow routing output option. Print out streamflow for specified stream reaches.
 		-version Prints the RHESSys version number, then exits immediately
+		-outschema Name of output schema file selecting the variables written
+				to daily/hourly zone, patch and stratum output (see
+				init/construct_output_schema.c for the format)
+		-ocomp	gzip or zstd.  Compress output files as they are written
+		-restart Name of a checkpoint file (.ckpt) to resume the run from
+		-ensemble Name of a table of sensitivity multipliers, one row per
+				member, and optionally the number of members run at once
+		-spinup	Tolerance and maximum number of cycles.  Repeat the
+				start to end date window until C and N pools are steady
+		-obs	Observed streamflow file and optional NSE threshold.
+				Print NSE, logNSE and pbias instead of daily output
+		-branch	Name of a table of scenario tec files, one per line,
+				and optionally the number of scenarios run at once
+		-outlet	Patch, zone and hillslope ID of an outlet patch.  Only
+				the area draining to it is simulated (needs -r)
+		-seed	Seed of the random draws (-precip); default the clock
+		-profile Time the main parts of the run and report them at
+				the end, with <prefix>_profile.csv
+		-memreport Tally allocations by array and report them, with
+				the resident set size, at the end of the run
+		-telemetry Seconds between progress reports on stderr and
+				optionally a status file rewritten with each report
+		-soiltable Tabulate soil porosity profiles, optionally with
+				the depth intervals per porosity_decay (default 16)
+		-adaptroute Choose the routing steps each day from the
+				fluxes, optionally with min, max (default 1 96)
+				and tolerance (default 0.05)
+		-routing_active_tol Route only patches whose outflow
+				exceeds tol (m/day) or whose stores changed
 
 	DESCRIPTION
 
@@ -168,6 +197,157 @@
 		The -pre option followed by a character string will add a
 		prefix to each output file. 
 
+		The -outschema option followed by a file name replaces the
+		fixed columns of the daily and hourly zone, patch and stratum
+		output with the variables listed for that level and time step
+		in the schema file.  Lines are "<level> <daily|hourly> var ..."
+		and values are written in model units.
+
+		The -ocomp option followed by gzip or zstd pipes each output
+		file through that compressor (which must be on the path) as
+		it is written, producing <prefix>_<level>.<step>.gz or .zst.
+		The compressor runs as a separate process, so compression
+		overlaps with the simulation.
+
+		The -restart option followed by a checkpoint file name
+		resumes a run from the state saved by an output_checkpoint
+		tec event.  The world, flow table, climate and tec file must
+		be the ones the checkpoint was written with, and the start
+		date must be on or before the checkpoint date; output is
+		then identical to the uninterrupted run from that date on.
+
+		The -ensemble option followed by a table of -s, -sv, -svalt,
+		-gw and -vgsen multipliers (see init/construct_ensemble.c)
+		runs one member per row.  The climate is read once and the
+		members are forked from it, so each member only builds its
+		own patches and runs; at most the given number (default one
+		per processor) run at a time.  Member output goes to
+		<prefix>_<member> and its stdout to <prefix>_<member>.log.
+
+		The -spinup option followed by a tolerance and a maximum
+		number of cycles (e.g. -spinup 0.001 500) repeats the start
+		to end date window, tec events included, until the soil,
+		litter and plant C and N pools of every patch change by
+		less than the tolerance (relative) over a cycle.  Without
+		routing, patches that have converged are no longer
+		simulated.  The final state is written as a worldfile as
+		by output_current_state.  Requires -g.
+
+		The -obs option followed by a file of observed daily
+		streamflow (year month day mm, negative if missing; see
+		init/construct_streamflow_objective.c) scores the first
+		basin's streamflow against it as the run goes, skips the
+		daily output, and prints one line at the end:
+			OBJECTIVES days <n> NSE <x> logNSE <x> pbias <x> complete
+		If an NSE threshold follows the file name the run stops as
+		soon as its NSE can no longer reach the threshold, and the
+		line ends with stopped instead.
+
+		The -branch option followed by a table of scenarios
+		(label and tec file per line; see tec/execute_branch_event.c)
+		runs the shared history once.  When the tec file reaches a
+		branch event the run forks one child per scenario, which
+		carries on from the shared world with the scenario's tec
+		file as the rest of its tec file.  Scenario output goes to
+		<prefix>_<label> and its stdout to <prefix>_<label>.log;
+		the output up to the branch date stays in <prefix>.  At
+		most the given number (default one per processor) of
+		scenarios run at a time.
+
+		The -outlet option followed by a patch, zone and hillslope
+		ID (in flow table order) finds the patches draining to that
+		patch through the flow table, and drops every other patch,
+		zone, hillslope and basin before the simulation starts (see
+		init/prune_world_to_outlet.c).  Basin output is then that
+		of the contributing area of the outlet.
+
+		The -seed option followed by a non-negative integer fixes
+		the random draws of stochastic precipitation scaling
+		(-precip).  Draws are keyed by seed, object and day (see
+		util/create_random_distrb.c), so a run with the same seed
+		gives the same output whatever order objects are simulated
+		in.  Without -seed the seed is taken from the clock and
+		printed.  Checkpoints store the seed and -restart reuses
+		it unless -seed is given.
+
+		The -profile option times world construction (climate
+		input and flow table reading within it), the simulation
+		and, within it, the daily and hourly world, zone, patch,
+		canopy, TOPMODEL and routing steps and each output event.
+		At the end of the run a table of calls, inclusive and
+		exclusive wall-clock seconds and share of the run is
+		printed, nested by caller, with the patch-days simulated
+		per second, and the same figures are written to
+		<prefix>_profile.csv (see output/output_profile.c).
+		Without -profile the timers cost one test per call.
+
+		The -memreport option tallies every allocation made
+		through alloc by array name and calling function (count,
+		bytes held and peak bytes) and prints the tallies, largest
+		first, with the current and peak resident set size at the
+		end of the simulation (see util/alloc.c).  An
+		output_memory_report tec event prints the same report at
+		its date; without -memreport it gives only the resident
+		set size.
+
+		The -telemetry option followed by a number of seconds
+		prints a progress line to stderr at the end of the first
+		simulated day after each such interval: the day reached,
+		simulated days and patch-days per second, the time left
+		to the end date at that rate, resident set size and the
+		share of time spent writing output.  A file name after
+		the interval is rewritten with the same figures as csv
+		at each report, state running or done, by renaming a
+		temporary file over it so a scheduler polling it never
+		reads a partial report (see output/output_telemetry.c).
+
+		The -soiltable option replaces the exponentials and
+		logarithms of compute_delta_water and compute_z_final
+		with a table of the pore volume above and below depths
+		porosity_decay / n apart, built once per soil default
+		for the n given (default 16), and short series within
+		each interval.  The relative error per lookup is below
+		1e-14 for the default and about 6e-10 for n = 4, and
+		does not depend on soil depth.  Soils with
+		constant porosity (porosity_decay >= 999), depths
+		outside the soil and tables of more than 2^20 intervals
+		are computed exactly (see hydro/soil_profile_table.c).
+
+		The -adaptroute option replaces the fixed
+		n_routing_timesteps of the basin default with a number
+		of subsurface routing steps chosen each day, between
+		the minimum and maximum given.  It doubles from the
+		minimum until, in every patch, one step drains at most
+		tol of the water below the water table and changes the
+		outflow by at most tol.  Days with ponded water or
+		return flow in any patch take at least the basin
+		default, since overland flow moves one patch per step
+		(see hydro/compute_routing_timesteps.c).  Infiltration
+		and vertical drainage keep the default step length.
+		The days, mean, minimum and maximum steps per basin
+		are reported at the end of the run.  Output is not the
+		same as with the fixed steps: it drifts by an amount
+		that grows with tol, so check it against a fixed-step
+		run of the world before relying on it (test/README.txt).
+
+		The -routing_active_tol option keeps an active set of
+		patches in subsurface routing.  tol is an outflow in
+		m/day; there is no default, and without the option
+		every patch is routed on every step.  A land patch whose
+		saturated and overland outflow on its last routed step
+		was at most tol, that nothing was routed into, and that
+		has no return flow, no ponding above capacity and no
+		ponded surface neighbour is skipped in the steps
+		between the first and the last.  The outflow of the
+		skipped steps is routed in one longer step when the
+		patch is next routed, so no water is lost and the mass
+		balance is exact.  With tol 0 only patches with no
+		outflow are skipped and the output is unchanged; with
+		tol > 0 the timing of the outflow of skipped patches
+		shifts, and output drifts by an amount that grows with
+		tol (see hydro/check_routing_active.c and
+		test/README.txt).
+
 		The -s option produces one output data file per time step.
 		The output file gives the response of each patch in the
 		basin for each model time step output is requested.
@@ -316,6 +496,17 @@ int	main( int main_argc, char **main_argv)
 	/*--------------------------------------------------------------*/
 	/* Local Function declarations 									*/
 	/*--------------------------------------------------------------*/
+	void	profile_start( struct profile_object *, int );
+	void	profile_stop( struct profile_object *, int );
+	struct	profile_object	*construct_profile( void );
+	void	alloc_accounting( int );
+	void	alloc_report( FILE * );
+	struct	telemetry_object	*construct_telemetry(
+		struct command_line_object *, struct world_object * );
+	void	output_telemetry( struct telemetry_object *,
+		struct profile_object *, struct date, int );
+	void	output_profile( struct profile_object *, char * );
+	void	output_routing_substeps( struct world_object * );
 	struct   command_line_object *construct_command_line(
 		int,
 		char **);
@@ -326,12 +517,31 @@ int	main( int main_argc, char **main_argv)
 	struct	world_output_file_object	*construct_output_files(
 		char *,
 		struct command_line_object	*);
+
+	struct	streamflow_objective_object	*construct_streamflow_objective(
+		char *,
+		struct date,
+		struct date);
+
+	void	output_streamflow_objective(
+		struct streamflow_objective_object *,
+		int);
+
+	struct	output_schema_object	*construct_output_schema(
+		char *);
 	
 	
 	struct	tec_object	*construct_tec(
 		struct command_line_object *,
 		struct world_object * );
 	
+	void 	execute_spinup(
+		struct	tec_object	*,
+		struct	command_line_object	*,
+		struct	world_output_file_object *,
+		struct	world_output_file_object *,
+		struct	world_object *);
+
 	void 	execute_tec(
 		struct	tec_object	*,
 		struct	command_line_object	*,
@@ -362,12 +572,24 @@ int	main( int main_argc, char **main_argv)
 		struct command_line_object * );
 
 	
-	srand((unsigned)(time(0)));
-
 	/*--------------------------------------------------------------*/
 	/*	Command line parsing.										*/
 	/*--------------------------------------------------------------*/
 	command_line = construct_command_line(main_argc, main_argv);
+	if ( (command_line[0].profile_flag == 1)
+		|| (command_line[0].telemetry_flag == 1) )
+		command_line[0].profile = construct_profile();
+	if (command_line[0].memreport_flag == 1)
+		alloc_accounting(1);
+
+	/*--------------------------------------------------------------*/
+	/*	Without -seed take the seed from the clock; it is printed	*/
+	/*	so the run can be repeated.									*/
+	/*--------------------------------------------------------------*/
+	if (command_line[0].seed_flag == 0)
+		command_line[0].seed = (unsigned long) time(0);
+	if (command_line[0].precip_scale_flag == 1)
+		printf("\n Random seed %lu\n", command_line[0].seed);
       
 	/*--------------------------------------------------------------*/
 	/* Check if print version flag was set. If so, just print out   */
@@ -382,10 +604,27 @@ int	main( int main_argc, char **main_argv)
 	if (command_line[0].verbose_flag > 0 )
 		fprintf(stderr,"FINISHED CON COMMAND LINE ***\n");
 	
+	/*--------------------------------------------------------------*/
+	/*	Read the output schema if one was given.					*/
+	/*--------------------------------------------------------------*/
+	if (command_line[0].output_schema_flag == 1)
+		command_line[0].output_schema =
+			construct_output_schema(command_line[0].output_schema_filename);
+
 	/*--------------------------------------------------------------*/
 	/*	Construct the world object.									*/
 	/*--------------------------------------------------------------*/
+	profile_start(command_line[0].profile, PROFILE_CONSTRUCT_WORLD);
 	world = construct_world( command_line );
+	profile_stop(command_line[0].profile, PROFILE_CONSTRUCT_WORLD);
+
+	/*--------------------------------------------------------------*/
+	/*	Read the observed streamflow for -obs objectives.			*/
+	/*--------------------------------------------------------------*/
+	if (command_line[0].obs_flag == 1)
+		command_line[0].objective = construct_streamflow_objective(
+			command_line[0].obs_filename,
+			world[0].start_date, world[0].end_date);
 	
 	if (command_line[0].verbose_flag > 0  )
 		fprintf(stderr,"FINISHED CON WORLD ***\n");
@@ -431,7 +670,36 @@ int	main( int main_argc, char **main_argv)
 	/*	AN EVENT LOOP WOULD GO HERE.								*/
 	/*--------------------------------------------------------------*/
 	fprintf(stderr,"Beginning Simulation\n");
-	execute_tec( tec, command_line, output, growth_output, world );
+	if (command_line[0].telemetry_flag == 1)
+		command_line[0].telemetry = construct_telemetry(command_line, world);
+	profile_start(command_line[0].profile, PROFILE_SIMULATION);
+	if (command_line[0].spinup_flag == 1)
+		execute_spinup( tec, command_line, output, growth_output, world );
+	else
+		execute_tec( tec, command_line, output, growth_output, world );
+	profile_stop(command_line[0].profile, PROFILE_SIMULATION);
+	if (command_line[0].telemetry != NULL)
+		output_telemetry(command_line[0].telemetry, command_line[0].profile,
+			world[0].end_date, 1);
+	if (command_line[0].obs_flag == 1)
+		output_streamflow_objective(command_line[0].objective, 1);
+	/*--------------------------------------------------------------*/
+	/*	Report the -profile timers.									*/
+	/*--------------------------------------------------------------*/
+	if (command_line[0].profile_flag == 1)
+		output_profile(command_line[0].profile, (command_line[0].output_prefix != NULL) ?
+			command_line[0].output_prefix : PRE);
+	/*--------------------------------------------------------------*/
+	/*	Report the -adaptroute routing steps.						*/
+	/*--------------------------------------------------------------*/
+	if ( (command_line[0].adaptive_routing_flag == 1)
+		&& (command_line[0].routing_flag == 1) )
+		output_routing_substeps(world);
+	/*--------------------------------------------------------------*/
+	/*	Report the -memreport tallies before anything is freed.		*/
+	/*--------------------------------------------------------------*/
+	if (command_line[0].memreport_flag == 1)
+		alloc_report(stdout);
 	if (command_line[0].verbose_flag > 0 )
 		fprintf(stderr,"FINISHED EXE TEC\n");
 	
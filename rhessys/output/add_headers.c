@@ -34,6 +34,12 @@ void add_headers(struct world_output_file_object *world_output_files,
 	/*--------------------------------------------------------------*/
 	/*	Local function definition.									*/
 	/*--------------------------------------------------------------*/
+	struct	output_schema_entry	*find_schema_entry(
+		struct command_line_object *, int, int);
+
+	void	add_schema_headers(
+		struct world_output_file_object *,
+		struct command_line_object *);
 	/*--------------------------------------------------------------*/
 	/*	Local variable definition.									*/
 	/*--------------------------------------------------------------*/
@@ -211,6 +217,7 @@ void add_headers(struct world_output_file_object *world_output_files,
 	/*	Daily 							*/
 	/*--------------------------------------------------------------*/
 	outfile = world_output_files[0].zone[0].daily;
+	if (find_schema_entry(command_line, SCHEMA_ZONE, SCHEMA_DAILY) == NULL)
 	fprintf(outfile,"%s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s\n " ,
 		"day",
 		"month",
@@ -248,6 +255,7 @@ void add_headers(struct world_output_file_object *world_output_files,
 	/*	Hourly 							*/
 	/*--------------------------------------------------------------*/
 	outfile = world_output_files[0].zone[0].hourly;
+	if (find_schema_entry(command_line, SCHEMA_ZONE, SCHEMA_HOURLY) == NULL)
 	fprintf(outfile,"%s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s\n " ,
 		"day",
 		"month",
@@ -278,6 +286,7 @@ void add_headers(struct world_output_file_object *world_output_files,
 	/*	Daily 							*/
 	/*--------------------------------------------------------------*/
 	outfile = world_output_files[0].patch[0].daily;
+	if (find_schema_entry(command_line, SCHEMA_PATCH, SCHEMA_DAILY) == NULL)
 	check = fprintf(outfile,
 		"%s %s %s %s %s %s %s %s %s %s  %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s\n" ,
 		"day",
@@ -367,6 +376,7 @@ void add_headers(struct world_output_file_object *world_output_files,
 	/*	Daily 							*/
 	/*--------------------------------------------------------------*/
 	outfile = world_output_files[0].canopy_stratum[0].daily;
+	if (find_schema_entry(command_line, SCHEMA_STRATUM, SCHEMA_DAILY) == NULL)
 	fprintf(outfile,
 		"%s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s %s \n" ,
 		"day",
@@ -439,5 +449,9 @@ void add_headers(struct world_output_file_object *world_output_files,
 		"reachID",
 		"routedstreamflow");
   }
+	/*--------------------------------------------------------------*/
+	/*	Output schema file headers				*/
+	/*--------------------------------------------------------------*/
+	add_schema_headers(world_output_files, command_line);
 	return;
 } /*end add_headers*/
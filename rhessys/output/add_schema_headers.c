@@ -0,0 +1,77 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					add_schema_headers					*/
+/*																*/
+/*	add_schema_headers - 									*/
+/*																*/
+/*	NAME														*/
+/*	add_schema_headers 										*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	void add_schema_headers(struct world output_file_object *,	*/
+/*			struct command_line_object *)					*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Adds headers for the daily and hourly zone, patch and	*/
+/*	canopy_stratum files that are written through an		*/
+/*	output schema (-outschema).  Column names are the		*/
+/*	registered variable names.								*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*																*/
+/*--------------------------------------------------------------*/
+
+#include <stdio.h>
+#include "rhessys.h"
+
+void add_schema_headers(struct world_output_file_object *world_output_files, 
+			struct command_line_object *command_line)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local function definition.									*/
+	/*--------------------------------------------------------------*/
+	struct	output_schema_entry	*find_schema_entry(
+		struct command_line_object *, int, int);
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	static char	*id_names[SCHEMA_NUM_LEVELS] = {
+		"basinID hillID zoneID",
+		"basinID hillID zoneID patchID",
+		"basinID hillID zoneID patchID stratumID"};
+	int	level, step, i;
+	FILE	*outfile;
+	struct	output_files_object	*fileset;
+	struct	output_schema_entry	*entry;
+
+	for (level=0; level < SCHEMA_NUM_LEVELS; level++){
+		if ((level == SCHEMA_ZONE) && (command_line[0].z != NULL))
+			fileset = world_output_files[0].zone;
+		else if ((level == SCHEMA_PATCH) && (command_line[0].p != NULL))
+			fileset = world_output_files[0].patch;
+		else if ((level == SCHEMA_STRATUM) && (command_line[0].c != NULL))
+			fileset = world_output_files[0].canopy_stratum;
+		else
+			continue;
+		for (step=0; step < SCHEMA_NUM_STEPS; step++){
+			if ((entry = find_schema_entry(command_line, level, step)) == NULL)
+				continue;
+			if (step == SCHEMA_HOURLY){
+				outfile = fileset[0].hourly;
+				fprintf(outfile, "day month year hour %s", id_names[level]);
+			}
+			else{
+				outfile = fileset[0].daily;
+				fprintf(outfile, "day month year %s", id_names[level]);
+			}
+			for (i=0; i < entry[0].num_vars; i++)
+				fprintf(outfile, " %s", entry[0].vars[i][0].name);
+			fprintf(outfile, "\n");
+		}
+	}
+	return;
+} /*end add_schema_headers*/
@@ -0,0 +1,126 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*						output_profile							*/
+/*																*/
+/*	output_profile - reports the -profile timers				*/
+/*																*/
+/*	NAME														*/
+/*	output_profile - reports the -profile timers				*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	void output_profile(										*/
+/*			struct	profile_object	*profile,					*/
+/*			char	*prefix)									*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Prints the regions that ran as a tree to stdout, with		*/
+/*	calls, inclusive and exclusive wall-clock seconds and the	*/
+/*	inclusive share of the total run time, followed by the		*/
+/*	patch-days simulated per second (patch_daily_F calls over	*/
+/*	the simulation time).  The same figures are written to		*/
+/*	<prefix>_profile.csv, one region per line:					*/
+/*																*/
+/*		region,parent,calls,inclusive_s,exclusive_s				*/
+/*																*/
+/*	with a total line for the whole run and a					*/
+/*	patch_days_per_s line.										*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include "rhessys.h"
+
+static char *profile_region_names[PROFILE_NUM_REGIONS] = {
+	"construct_world",
+	"climate",
+	"construct_routing_topology",
+	"simulation",
+	"world_daily_I",
+	"zone_daily_I",
+	"patch_daily_I",
+	"world_hourly",
+	"world_daily_F",
+	"patch_daily_F",
+	"canopy_stratum_daily_F",
+	"top_model",
+	"compute_subsurface_routing",
+	"compute_stream_routing",
+	"hourly_output",
+	"daily_output",
+	"daily_growth_output",
+	"monthly_output",
+	"yearly_output",
+	"yearly_growth_output"};
+
+void	output_profile(
+					   struct	profile_object	*profile,
+					   char	*prefix)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local function definition.									*/
+	/*--------------------------------------------------------------*/
+	double	profile_clock( void );
+
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	int	i, r, depth;
+	double	total, patch_days_per_s;
+	char	filename[MAXSTR];
+	FILE	*csv_file;
+
+	total = profile_clock() - profile[0].start_time;
+	if (profile[0].inclusive[PROFILE_SIMULATION] > 0.0)
+		patch_days_per_s = profile[0].calls[PROFILE_PATCH_DAILY_F]
+			/ profile[0].inclusive[PROFILE_SIMULATION];
+	else
+		patch_days_per_s = 0.0;
+	/*--------------------------------------------------------------*/
+	/*	table														*/
+	/*--------------------------------------------------------------*/
+	printf("\n Profile (wall clock seconds)\n");
+	printf(" %-34s %12s %12s %12s %7s\n", "region", "calls",
+		"inclusive", "exclusive", "%total");
+	for (r=0; r < PROFILE_NUM_REGIONS; r++){
+		if (profile[0].calls[r] == 0)
+			continue;
+		depth = 0;
+		for (i=profile[0].parent[r]; i >= 0; i=profile[0].parent[i])
+			depth++;
+		printf(" %*s%-*s %12ld %12.4f %12.4f %6.1f%%\n", 2*depth, "",
+			34 - 2*depth, profile_region_names[r], profile[0].calls[r],
+			profile[0].inclusive[r], profile[0].exclusive[r],
+			(total > 0.0) ? 100.0 * profile[0].inclusive[r] / total : 0.0);
+	}
+	printf(" %-34s %12s %12.4f\n", "total", "", total);
+	printf(" %.0f patch-days per second\n", patch_days_per_s);
+	/*--------------------------------------------------------------*/
+	/*	csv															*/
+	/*--------------------------------------------------------------*/
+	snprintf(filename, MAXSTR, "%s_profile.csv", prefix);
+	if ( (csv_file = fopen(filename, "w")) == NULL ){
+		fprintf(stderr,"FATAL ERROR: Unable to open profile file %s\n",
+			filename);
+		exit(EXIT_FAILURE);
+	}
+	fprintf(csv_file,"region,parent,calls,inclusive_s,exclusive_s\n");
+	for (r=0; r < PROFILE_NUM_REGIONS; r++){
+		if (profile[0].calls[r] == 0)
+			continue;
+		fprintf(csv_file,"%s,%s,%ld,%.6f,%.6f\n", profile_region_names[r],
+			(profile[0].parent[r] >= 0) ?
+			profile_region_names[profile[0].parent[r]] : "",
+			profile[0].calls[r], profile[0].inclusive[r],
+			profile[0].exclusive[r]);
+	}
+	fprintf(csv_file,"total,,1,%.6f,\n", total);
+	fprintf(csv_file,"patch_days_per_s,,%ld,%.2f,\n",
+		profile[0].calls[PROFILE_PATCH_DAILY_F], patch_days_per_s);
+	fclose(csv_file);
+	return;
+} /*end output_profile*/
@@ -0,0 +1,55 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					output_routing_substeps						*/
+/*																*/
+/*	output_routing_substeps - reports the -adaptroute steps		*/
+/*																*/
+/*	NAME														*/
+/*	output_routing_substeps - reports the -adaptroute steps		*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	void output_routing_substeps(								*/
+/*			struct	world_object	*world)						*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Prints one line per basin to stdout with the days routed,	*/
+/*	the mean, minimum and maximum routing steps per day chosen	*/
+/*	by compute_routing_timesteps, and the days routed in one	*/
+/*	or two steps.												*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*	The daily choice is printed as it is made with -v 2 or		*/
+/*	more.														*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include "rhessys.h"
+
+void	output_routing_substeps(
+								struct	world_object	*world)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	int	b;
+	struct	basin_object	*basin;
+
+	printf("\n Adaptive routing steps per day\n");
+	printf(" %10s %10s %10s %6s %6s %10s\n", "basin", "days", "mean",
+		"min", "max", "days<=2");
+	for (b=0; b < world[0].num_basin_files; b++){
+		basin = world[0].basins[b];
+		printf(" %10d %10ld %10.2f %6d %6d %10ld\n", basin[0].ID,
+			basin[0].routing_substep_days,
+			(basin[0].routing_substep_days > 0) ?
+			(double) basin[0].routing_substep_total
+			/ basin[0].routing_substep_days : 0.0,
+			basin[0].routing_substep_min, basin[0].routing_substep_max,
+			basin[0].routing_substep_dry_days);
+	}
+	return;
+} /*end output_routing_substeps*/
@@ -0,0 +1,74 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					output_schema_record						*/
+/*																*/
+/*	output_schema_record - outputs the schema variables of an	*/
+/*				object.											*/
+/*																*/
+/*	NAME														*/
+/*	output_schema_record - outputs the schema variables of an	*/
+/*				object.											*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	void	output_schema_record(								*/
+/*					struct	output_schema_entry	*entry,			*/
+/*					int	num_ids,								*/
+/*					int	*ids,									*/
+/*					void	*object,							*/
+/*					int	hourly,									*/
+/*					struct	date	date,  						*/
+/*					FILE 	*outfile)							*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Writes one line: the date (with hour if hourly), the		*/
+/*	spatial IDs and then each variable of the schema entry,		*/
+/*	read from object through its offset or accessor.			*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include "rhessys.h"
+
+void	output_schema_record(
+							 struct	output_schema_entry	*entry,
+							 int	num_ids,
+							 int	*ids,
+							 void	*object,
+							 int	hourly,
+							 struct	date	current_date,
+							 FILE	*outfile)
+{
+	/*------------------------------------------------------*/
+	/*	Local Variable Definition. 							*/
+	/*------------------------------------------------------*/
+	int	i, check;
+	double	value;
+	struct	output_variable	*variable;
+
+	if (hourly == 1)
+		check = fprintf(outfile, "%ld %ld %ld %ld", current_date.day,
+			current_date.month, current_date.year, current_date.hour);
+	else
+		check = fprintf(outfile, "%ld %ld %ld", current_date.day,
+			current_date.month, current_date.year);
+	for (i=0; i < num_ids; i++)
+		fprintf(outfile, " %d", ids[i]);
+	for (i=0; i < entry[0].num_vars; i++){
+		variable = entry[0].vars[i];
+		if (variable[0].accessor != NULL)
+			value = variable[0].accessor(object);
+		else
+			value = *((double *)((char *) object + variable[0].offset));
+		fprintf(outfile, " %.8g", value);
+	}
+	fprintf(outfile, "\n");
+
+	if (check <= 0) {
+		fprintf(stdout, "\nWARNING: output error has occured in output_schema_record");
+	}
+	return;
+} /*end output_schema_record*/
@@ -0,0 +1,389 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					output_schema_variables						*/
+/*																*/
+/*	output_schema_variables - registry of named output variables	*/
+/*																*/
+/*	NAME														*/
+/*	find_output_variable - look up a named output variable		*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	struct output_variable *find_output_variable(				*/
+/*					int	level,									*/
+/*					char	*name)								*/
+/*																*/
+/*	OPTIONS														*/
+/*	level - SCHEMA_ZONE, SCHEMA_PATCH or SCHEMA_STRATUM			*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Holds one table per spatial level mapping variable names	*/
+/*	used in an output schema file (-outschema) to the offset	*/
+/*	of a double in the zone, patch or canopy_strata object, or	*/
+/*	to an accessor for values that are derived from several		*/
+/*	fields.  Names of offset variables are the struct member	*/
+/*	path (e.g. snowpack.water_equivalent_depth) and values		*/
+/*	are written in model units (m water, kgC/m2, kgN/m2 ...)	*/
+/*	not the mm conversions of the fixed format output.			*/
+/*	Returns NULL if the name is not registered.					*/
+/*	The redefine_world_sparse event sets state by the same		*/
+/*	names; only the *_STATE entries, the water, snow, carbon	*/
+/*	and nitrogen stores, can be set that way.  Geometry,		*/
+/*	forcing, fluxes and diagnostics are output only.			*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*	To make a new variable available add one line to the		*/
+/*	table for its level; no other output routine or header		*/
+/*	needs to change.  Use *_STATE only for a store that the	*/
+/*	model carries from day to day and that nothing else is		*/
+/*	derived from at construction.								*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <stddef.h>
+#include <string.h>
+#include "rhessys.h"
+
+#define ZONE_VAR(field)	{ #field, offsetof(struct zone_object, field), NULL, 0 }
+#define PATCH_VAR(field)	{ #field, offsetof(struct patch_object, field), NULL, 0 }
+#define PATCH_STATE(field)	{ #field, offsetof(struct patch_object, field), NULL, 1 }
+#define STRATUM_VAR(field)	{ #field, offsetof(struct canopy_strata_object, field), NULL, 0 }
+#define STRATUM_STATE(field)	{ #field, offsetof(struct canopy_strata_object, field), NULL, 1 }
+#define DERIVED_VAR(name, accessor)	{ name, 0, accessor, 0 }
+
+/*--------------------------------------------------------------*/
+/*	Derived zone variables.										*/
+/*--------------------------------------------------------------*/
+static double zone_precip(void *object)
+{
+	struct zone_object *zone = (struct zone_object *) object;
+	return(zone[0].rain + zone[0].snow);
+}
+
+/*--------------------------------------------------------------*/
+/*	Derived patch variables - cover fraction weighted strata	*/
+/*	sums as computed in output_patch.							*/
+/*--------------------------------------------------------------*/
+static double patch_strata_sum(struct patch_object *patch, size_t offset)
+{
+	int layer, c;
+	double sum;
+	struct canopy_strata_object *stratum;
+
+	sum = 0.0;
+	for ( layer=0 ; layer<patch[0].num_layers; layer++ ){
+		for ( c=0 ; c<patch[0].layers[layer].count; c++ ){
+			stratum = patch[0].canopy_strata[(patch[0].layers[layer].strata[c])];
+			sum += stratum[0].cover_fraction
+				* *((double *)((char *) stratum + offset));
+		}
+	}
+	return(sum);
+}
+
+static double patch_lai(void *object)
+{
+	return(patch_strata_sum((struct patch_object *) object,
+		offsetof(struct canopy_strata_object, epv.proj_lai)));
+}
+
+static double patch_psn(void *object)
+{
+	return(patch_strata_sum((struct patch_object *) object,
+		offsetof(struct canopy_strata_object, cs.net_psn)));
+}
+
+static double patch_sublimation(void *object)
+{
+	struct patch_object *patch = (struct patch_object *) object;
+	return(patch[0].snowpack.sublimation + patch_strata_sum(patch,
+		offsetof(struct canopy_strata_object, sublimation)));
+}
+
+static double patch_trans(void *object)
+{
+	struct patch_object *patch = (struct patch_object *) object;
+	return(patch[0].transpiration_sat_zone + patch[0].transpiration_unsat_zone);
+}
+
+static double patch_exfiltration(void *object)
+{
+	struct patch_object *patch = (struct patch_object *) object;
+	return(patch[0].exfiltration_sat_zone + patch[0].exfiltration_unsat_zone);
+}
+
+static double patch_litter_S(void *object)
+{
+	struct patch_object *patch = (struct patch_object *) object;
+	if (patch[0].litter.rain_capacity > ZERO)
+		return(patch[0].litter.rain_stored / patch[0].litter.rain_capacity);
+	else
+		return(1.0);
+}
+
+static double patch_precip(void *object)
+{
+	struct patch_object *patch = (struct patch_object *) object;
+	return(patch[0].zone[0].rain + patch[0].zone[0].snow);
+}
+
+/*--------------------------------------------------------------*/
+/*	Derived stratum variables.									*/
+/*--------------------------------------------------------------*/
+static double stratum_trans(void *object)
+{
+	struct canopy_strata_object *stratum = (struct canopy_strata_object *) object;
+	return(stratum[0].transpiration_sat_zone + stratum[0].transpiration_unsat_zone);
+}
+
+static double stratum_plantc(void *object)
+{
+	struct canopy_strata_object *stratum = (struct canopy_strata_object *) object;
+	return(stratum[0].cs.leafc + stratum[0].cs.dead_leafc
+		+ stratum[0].cs.live_stemc + stratum[0].cs.dead_stemc
+		+ stratum[0].cs.live_crootc + stratum[0].cs.dead_crootc
+		+ stratum[0].cs.frootc + stratum[0].cs.cpool);
+}
+
+/*--------------------------------------------------------------*/
+/*	Variable tables.											*/
+/*--------------------------------------------------------------*/
+static struct output_variable zone_variables[] = {
+	ZONE_VAR(rain),
+	ZONE_VAR(snow),
+	DERIVED_VAR("precip", zone_precip),
+	ZONE_VAR(metv.tmax),
+	ZONE_VAR(metv.tmin),
+	ZONE_VAR(metv.tavg),
+	ZONE_VAR(metv.tday),
+	ZONE_VAR(metv.tnight),
+	ZONE_VAR(metv.tsoil),
+	ZONE_VAR(metv.vpd),
+	ZONE_VAR(metv.dayl),
+	ZONE_VAR(metv.pa),
+	ZONE_VAR(Kdown_direct),
+	ZONE_VAR(Kdown_diffuse),
+	ZONE_VAR(PAR_direct),
+	ZONE_VAR(PAR_diffuse),
+	ZONE_VAR(Ldown),
+	ZONE_VAR(relative_humidity),
+	ZONE_VAR(tdewpoint),
+	ZONE_VAR(e_dewpoint),
+	ZONE_VAR(wind),
+	ZONE_VAR(CO2),
+	ZONE_VAR(ndep_NO3),
+	ZONE_VAR(ndep_NH4),
+	ZONE_VAR(cloud_fraction),
+	ZONE_VAR(atm_trans),
+	ZONE_VAR(daytime_rain_duration),
+	ZONE_VAR(aspect),
+	ZONE_VAR(slope),
+	ZONE_VAR(z),
+	{ NULL, 0, NULL, 0 }
+};
+
+static struct output_variable patch_variables[] = {
+	PATCH_VAR(area),
+	PATCH_VAR(rain_throughfall),
+	PATCH_VAR(snow_throughfall),
+	PATCH_STATE(detention_store),
+	PATCH_STATE(sat_deficit),
+	PATCH_VAR(sat_deficit_z),
+	PATCH_STATE(rz_storage),
+	PATCH_STATE(unsat_storage),
+	PATCH_VAR(rootzone.potential_sat),
+	PATCH_VAR(rootzone.field_capacity),
+	PATCH_VAR(rootzone.depth),
+	PATCH_VAR(rootzone.S),
+	PATCH_VAR(field_capacity),
+	PATCH_VAR(wilting_point),
+	PATCH_VAR(rz_drainage),
+	PATCH_VAR(unsat_drainage),
+	PATCH_VAR(cap_rise),
+	PATCH_VAR(recharge),
+	PATCH_VAR(return_flow),
+	PATCH_VAR(base_flow),
+	PATCH_VAR(streamflow),
+	PATCH_VAR(gw_drainage),
+	PATCH_VAR(Qin_total),
+	PATCH_VAR(Qout_total),
+	PATCH_VAR(surface_Qin),
+	PATCH_VAR(surface_Qout),
+	PATCH_VAR(evaporation),
+	PATCH_VAR(evaporation_surf),
+	PATCH_VAR(transpiration_sat_zone),
+	PATCH_VAR(transpiration_unsat_zone),
+	DERIVED_VAR("trans", patch_trans),
+	PATCH_VAR(exfiltration_sat_zone),
+	PATCH_VAR(exfiltration_unsat_zone),
+	DERIVED_VAR("exfiltration", patch_exfiltration),
+	PATCH_VAR(PET),
+	PATCH_VAR(PE),
+	PATCH_VAR(snow_melt),
+	PATCH_STATE(snowpack.water_equivalent_depth),
+	PATCH_STATE(snowpack.water_depth),
+	PATCH_STATE(snowpack.T),
+	PATCH_STATE(snowpack.energy_deficit),
+	PATCH_STATE(snowpack.surface_age),
+	PATCH_VAR(snowpack.sublimation),
+	DERIVED_VAR("sublimation", patch_sublimation),
+	PATCH_STATE(litter.rain_stored),
+	PATCH_VAR(litter.cover_fraction),
+	DERIVED_VAR("litter_S", patch_litter_S),
+	DERIVED_VAR("lai", patch_lai),
+	DERIVED_VAR("psn", patch_psn),
+	DERIVED_VAR("precip", patch_precip),
+	PATCH_VAR(Kdown_direct),
+	PATCH_VAR(Kdown_diffuse),
+	PATCH_VAR(Tsoil),
+	PATCH_VAR(surface_Tday),
+	PATCH_VAR(surface_Tnight),
+	PATCH_VAR(soil_cs.totalc),
+	PATCH_STATE(soil_cs.DOC),
+	PATCH_VAR(soil_ns.totaln),
+	PATCH_STATE(soil_ns.sminn),
+	PATCH_STATE(soil_ns.nitrate),
+	PATCH_STATE(soil_ns.DON),
+	PATCH_VAR(soil_ns.leach),
+	PATCH_STATE(soil_cs.soil1c),
+	PATCH_STATE(soil_cs.soil2c),
+	PATCH_STATE(soil_cs.soil3c),
+	PATCH_STATE(soil_cs.soil4c),
+	PATCH_STATE(soil_ns.soil1n),
+	PATCH_STATE(soil_ns.soil2n),
+	PATCH_STATE(soil_ns.soil3n),
+	PATCH_STATE(soil_ns.soil4n),
+	PATCH_STATE(litter_cs.litr1c),
+	PATCH_STATE(litter_cs.litr2c),
+	PATCH_STATE(litter_cs.litr3c),
+	PATCH_STATE(litter_cs.litr4c),
+	PATCH_STATE(litter_ns.litr1n),
+	PATCH_STATE(litter_ns.litr2n),
+	PATCH_STATE(litter_ns.litr3n),
+	PATCH_STATE(litter_ns.litr4n),
+	PATCH_VAR(streamflow_NO3),
+	PATCH_VAR(streamflow_NH4),
+	PATCH_VAR(streamflow_DOC),
+	PATCH_VAR(streamflow_DON),
+	PATCH_STATE(surface_NO3),
+	PATCH_STATE(surface_NH4),
+	PATCH_VAR(satzone_nitrate),
+	PATCH_VAR(totalc),
+	PATCH_VAR(totaln),
+	PATCH_VAR(net_plant_psn),
+	PATCH_VAR(water_balance),
+	PATCH_VAR(carbon_balance),
+	PATCH_VAR(nitrogen_balance),
+	PATCH_VAR(burn),
+	{ NULL, 0, NULL, 0 }
+};
+
+static struct output_variable stratum_variables[] = {
+	STRATUM_VAR(cover_fraction),
+	STRATUM_VAR(epv.proj_lai),
+	STRATUM_VAR(epv.all_lai),
+	STRATUM_VAR(epv.proj_pai),
+	STRATUM_VAR(epv.height),
+	STRATUM_VAR(epv.psi),
+	STRATUM_VAR(epv.max_proj_lai),
+	STRATUM_VAR(epv.max_fparabs),
+	STRATUM_VAR(epv.min_vwc),
+	STRATUM_VAR(epv.prev_leafcalloc),
+	STRATUM_VAR(evaporation),
+	STRATUM_VAR(sublimation),
+	STRATUM_VAR(transpiration_sat_zone),
+	STRATUM_VAR(transpiration_unsat_zone),
+	DERIVED_VAR("trans", stratum_trans),
+	STRATUM_VAR(PET),
+	STRATUM_STATE(rain_stored),
+	STRATUM_STATE(snow_stored),
+	STRATUM_VAR(gs),
+	STRATUM_VAR(gs_sunlit),
+	STRATUM_VAR(gs_shade),
+	STRATUM_VAR(ga),
+	STRATUM_VAR(Kstar_direct),
+	STRATUM_VAR(Kstar_diffuse),
+	STRATUM_VAR(APAR_direct),
+	STRATUM_VAR(APAR_diffuse),
+	STRATUM_VAR(Lstar),
+	STRATUM_VAR(dC13),
+	STRATUM_VAR(rootzone.depth),
+	STRATUM_VAR(cs.net_psn),
+	STRATUM_STATE(cs.cpool),
+	STRATUM_VAR(cs.availc),
+	STRATUM_STATE(cs.leafc),
+	STRATUM_STATE(cs.dead_leafc),
+	STRATUM_STATE(cs.live_stemc),
+	STRATUM_STATE(cs.dead_stemc),
+	STRATUM_STATE(cs.live_crootc),
+	STRATUM_STATE(cs.dead_crootc),
+	STRATUM_STATE(cs.frootc),
+	STRATUM_STATE(cs.leafc_store),
+	STRATUM_STATE(cs.leafc_transfer),
+	STRATUM_STATE(cs.livestemc_store),
+	STRATUM_STATE(cs.livestemc_transfer),
+	STRATUM_STATE(cs.deadstemc_store),
+	STRATUM_STATE(cs.deadstemc_transfer),
+	STRATUM_STATE(cs.livecrootc_store),
+	STRATUM_STATE(cs.livecrootc_transfer),
+	STRATUM_STATE(cs.deadcrootc_store),
+	STRATUM_STATE(cs.deadcrootc_transfer),
+	STRATUM_STATE(cs.frootc_store),
+	STRATUM_STATE(cs.frootc_transfer),
+	STRATUM_STATE(cs.cwdc),
+	DERIVED_VAR("plantc", stratum_plantc),
+	STRATUM_STATE(ns.npool),
+	STRATUM_STATE(ns.leafn),
+	STRATUM_STATE(ns.frootn),
+	STRATUM_STATE(ns.dead_leafn),
+	STRATUM_STATE(ns.leafn_store),
+	STRATUM_STATE(ns.leafn_transfer),
+	STRATUM_STATE(ns.live_stemn),
+	STRATUM_STATE(ns.livestemn_store),
+	STRATUM_STATE(ns.livestemn_transfer),
+	STRATUM_STATE(ns.dead_stemn),
+	STRATUM_STATE(ns.deadstemn_store),
+	STRATUM_STATE(ns.deadstemn_transfer),
+	STRATUM_STATE(ns.live_crootn),
+	STRATUM_STATE(ns.livecrootn_store),
+	STRATUM_STATE(ns.livecrootn_transfer),
+	STRATUM_STATE(ns.dead_crootn),
+	STRATUM_STATE(ns.deadcrootn_store),
+	STRATUM_STATE(ns.deadcrootn_transfer),
+	STRATUM_STATE(ns.frootn_store),
+	STRATUM_STATE(ns.frootn_transfer),
+	STRATUM_STATE(ns.cwdn),
+	STRATUM_STATE(ns.retransn),
+	STRATUM_VAR(mult_conductance.APAR),
+	STRATUM_VAR(mult_conductance.LWP),
+	STRATUM_VAR(mult_conductance.vpd),
+	{ NULL, 0, NULL, 0 }
+};
+
+struct output_variable *find_output_variable(int level, char *name)
+{
+	/*------------------------------------------------------*/
+	/*	Local Variable Definition. 							*/
+	/*------------------------------------------------------*/
+	int	i;
+	struct	output_variable	*table;
+
+	switch (level) {
+	case SCHEMA_ZONE:
+		table = zone_variables;
+		break;
+	case SCHEMA_PATCH:
+		table = patch_variables;
+		break;
+	case SCHEMA_STRATUM:
+		table = stratum_variables;
+		break;
+	default:
+		return(NULL);
+	}
+	for (i=0; table[i].name != NULL; i++)
+		if (strcmp(table[i].name, name) == 0)
+			return(&(table[i]));
+	return(NULL);
+} /*end find_output_variable*/
@@ -0,0 +1,51 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					output_streamflow_objective					*/
+/*																*/
+/*	output_streamflow_objective - prints the -obs summary line	*/
+/*																*/
+/*	NAME														*/
+/*	output_streamflow_objective - prints the -obs summary line	*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	void output_streamflow_objective(							*/
+/*			struct	streamflow_objective_object	*objective,		*/
+/*			int	complete)										*/
+/*																*/
+/*	OPTIONS														*/
+/*	complete - 1 at the end of the run, 0 when the run was		*/
+/*		stopped early by the -obs threshold						*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Prints one line to stdout:									*/
+/*																*/
+/*	OBJECTIVES days <n> NSE <x> logNSE <x> pbias <x> <status>	*/
+/*																*/
+/*	where n is the number of observed days simulated, pbias		*/
+/*	is 100 * sum(sim - obs) / sum(obs) over those days and		*/
+/*	status is complete or stopped.  NSE and logNSE are			*/
+/*	1 - sse / sst with sst over every observed day of the run;	*/
+/*	for a stopped run they are upper bounds on the values the	*/
+/*	full run would have reached.								*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include "rhessys.h"
+
+void	output_streamflow_objective(
+									struct	streamflow_objective_object	*objective,
+									int	complete)
+{
+	printf("\nOBJECTIVES days %d NSE %.6f logNSE %.6f pbias %.4f %s\n",
+		objective[0].n,
+		1.0 - objective[0].sse / objective[0].sst,
+		1.0 - objective[0].log_sse / objective[0].log_sst,
+		(objective[0].sum_obs > 0.0) ?
+		100.0 * objective[0].sum_error / objective[0].sum_obs : 0.0,
+		complete ? "complete" : "stopped");
+	fflush(stdout);
+	return;
+} /*end output_streamflow_objective*/
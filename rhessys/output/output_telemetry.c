@@ -0,0 +1,141 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					output_telemetry							*/
+/*																*/
+/*	output_telemetry - reports -telemetry progress				*/
+/*																*/
+/*	NAME														*/
+/*	output_telemetry - reports -telemetry progress				*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	void output_telemetry(										*/
+/*			struct	telemetry_object	*telemetry,				*/
+/*			struct	profile_object	*profile,					*/
+/*			struct	date	current_date,						*/
+/*			int	final)											*/
+/*																*/
+/*	OPTIONS														*/
+/*	final	- 1 at the end of the run (current_date is then		*/
+/*			ignored), 0 after each day							*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Called by execute_tec at the end of each simulated day		*/
+/*	(current_date).  Once at least the -telemetry interval has	*/
+/*	passed since the last report, prints one line to stderr:	*/
+/*	the day reached, simulated days and patch-days per			*/
+/*	second, time to the end date at that rate, resident set		*/
+/*	size and the share of the time spent in output events.		*/
+/*	The final call (from main) always reports.					*/
+/*																*/
+/*	If a status file was given the same figures are written		*/
+/*	to it on each report as a header line and a value line:	*/
+/*																*/
+/*		state,date,days_done,num_days,elapsed_s,days_per_s,		*/
+/*		patch_days_per_s,eta_s,rss_mb,simulation_s,output_s		*/
+/*																*/
+/*	with state running or done.  The file is written under a	*/
+/*	temporary name and renamed over the old one, so a reader	*/
+/*	always sees a complete report.								*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*	Rates are averages since the simulation started.  With		*/
+/*	-spinup the day count restarts with each cycle.				*/
+/*	Branch scenarios (see execute_branch_event) report to		*/
+/*	<status file>_<label>.										*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include "rhessys.h"
+
+void	output_telemetry(
+						 struct	telemetry_object	*telemetry,
+						 struct	profile_object	*profile,
+						 struct	date	current_date,
+						 int	final)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local function definition.									*/
+	/*--------------------------------------------------------------*/
+	double	profile_clock( void );
+	long	julday( struct date );
+	void	resident_set_size( double *, double * );
+
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	int	r;
+	long	eta;
+	double	now, elapsed, output_time, days_per_s, rss, peak_rss;
+	char	filename[FILEPATH_LEN];
+	FILE	*status_file;
+
+	now = profile_clock();
+	if (final == 0){
+		telemetry[0].last_date = current_date;
+		telemetry[0].days_done = julday(current_date)
+			- telemetry[0].start_julday + 1;
+		if (now - telemetry[0].last_time < telemetry[0].interval)
+			return;
+	}
+	telemetry[0].last_time = now;
+	elapsed = now - telemetry[0].start_time;
+	output_time = 0.0;
+	if (profile != NULL)
+		for (r=PROFILE_HOURLY_OUTPUT; r <= PROFILE_YEARLY_GROWTH_OUTPUT; r++)
+			output_time += profile[0].inclusive[r];
+	days_per_s = (elapsed > 0.0) ? telemetry[0].days_done / elapsed : 0.0;
+	if (days_per_s > 0.0)
+		eta = (long) ((telemetry[0].num_days - telemetry[0].days_done)
+			/ days_per_s + 0.5);
+	else
+		eta = -1;
+	if (eta < 0)
+		eta = 0;
+	resident_set_size(&rss, &peak_rss);
+	/*--------------------------------------------------------------*/
+	/*	progress line												*/
+	/*--------------------------------------------------------------*/
+	fprintf(stderr,
+		"%s %ld-%02ld-%02ld day %ld of %ld, %.1f days/s, %.0f patch-days/s, "
+		"ETA %ld:%02ld:%02ld, RSS %.1f MB, output %.0f%%\n",
+		(final == 1) ? "Done" : "Progress",
+		telemetry[0].last_date.year, telemetry[0].last_date.month,
+		telemetry[0].last_date.day, telemetry[0].days_done, telemetry[0].num_days, days_per_s,
+		days_per_s * telemetry[0].num_patches,
+		eta / 3600, (eta / 60) % 60, eta % 60, rss,
+		(elapsed > 0.0) ? 100.0 * output_time / elapsed : 0.0);
+	/*--------------------------------------------------------------*/
+	/*	status file, replaced in one rename							*/
+	/*--------------------------------------------------------------*/
+	if (telemetry[0].status_filename == NULL)
+		return;
+	if (snprintf(filename, FILEPATH_LEN, "%s.tmp",
+		telemetry[0].status_filename) >= FILEPATH_LEN){
+		fprintf(stderr,"FATAL ERROR: status file name %s too long\n",
+			telemetry[0].status_filename);
+		exit(EXIT_FAILURE);
+	}
+	if ( (status_file = fopen(filename, "w")) == NULL ){
+		fprintf(stderr,"FATAL ERROR: Unable to open status file %s\n",
+			filename);
+		exit(EXIT_FAILURE);
+	}
+	fprintf(status_file,"state,date,days_done,num_days,elapsed_s,days_per_s,"
+		"patch_days_per_s,eta_s,rss_mb,simulation_s,output_s\n");
+	fprintf(status_file,"%s,%ld-%02ld-%02ld,%ld,%ld,%.3f,%.3f,%.1f,%ld,%.1f,%.3f,%.3f\n",
+		(final == 1) ? "done" : "running",
+		telemetry[0].last_date.year, telemetry[0].last_date.month,
+		telemetry[0].last_date.day, telemetry[0].days_done, telemetry[0].num_days, elapsed, days_per_s,
+		days_per_s * telemetry[0].num_patches, eta, rss,
+		elapsed - output_time, output_time);
+	if ( (fclose(status_file) != 0)
+		|| (rename(filename, telemetry[0].status_filename) != 0) ){
+		fprintf(stderr,"FATAL ERROR: Unable to write status file %s\n",
+			telemetry[0].status_filename);
+		exit(EXIT_FAILURE);
+	}
+	return;
+} /*end output_telemetry*/
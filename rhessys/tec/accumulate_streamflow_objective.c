@@ -0,0 +1,87 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*				accumulate_streamflow_objective					*/
+/*																*/
+/*	accumulate_streamflow_objective - adds one day to the -obs	*/
+/*			calibration objectives								*/
+/*																*/
+/*	NAME														*/
+/*	accumulate_streamflow_objective - adds one day to the -obs	*/
+/*			calibration objectives								*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	void accumulate_streamflow_objective(						*/
+/*			struct	world_object	*world,						*/
+/*			struct	command_line_object	*command_line,			*/
+/*			struct	date	current_date)						*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Called by execute_tec at the end of each day.  If the day	*/
+/*	has an observation, the streamflow of the first basin		*/
+/*	(compute_basin_streamflow, in mm) is compared with it and	*/
+/*	the error sums are updated.									*/
+/*																*/
+/*	If a threshold was given with -obs, the run ends as soon	*/
+/*	as NSE can no longer reach it: sse only grows and sst is	*/
+/*	fixed, so 1 - sse/sst is an upper bound on the final NSE.	*/
+/*	The summary line is then printed and the program exits		*/
+/*	successfully.												*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "rhessys.h"
+
+void	accumulate_streamflow_objective(
+									 struct	world_object	*world,
+									 struct	command_line_object	*command_line,
+									 struct	date	current_date)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local function definition.									*/
+	/*--------------------------------------------------------------*/
+	long	julday( struct date );
+	double	compute_basin_streamflow(
+		struct	command_line_object *,
+		struct	basin_object *);
+	void	output_streamflow_objective(
+		struct	streamflow_objective_object *,
+		int);
+
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	long	day;
+	double	obs, sim, error;
+	struct	streamflow_objective_object	*objective;
+
+	objective = command_line[0].objective;
+	current_date.hour = 1;
+	day = julday(current_date) - objective[0].start_julday;
+	if ( (day < 0) || (day >= objective[0].num_days)
+		|| ((obs = objective[0].obs[day]) < 0.0) )
+		return;
+	sim = 1000.0 * compute_basin_streamflow(command_line, world[0].basins[0]);
+	error = sim - obs;
+	objective[0].n += 1;
+	objective[0].sse += error * error;
+	error = log(max(sim, 0.0) + OBJECTIVE_LOG_OFFSET)
+		- log(obs + OBJECTIVE_LOG_OFFSET);
+	objective[0].log_sse += error * error;
+	objective[0].sum_obs += obs;
+	objective[0].sum_error += sim - obs;
+
+	if ( (command_line[0].obs_threshold_flag == 1)
+		&& (1.0 - objective[0].sse / objective[0].sst
+		< command_line[0].obs_threshold) ){
+		output_streamflow_objective(objective, 0);
+		exit(EXIT_SUCCESS);
+	}
+	return;
+} /*end accumulate_streamflow_objective*/
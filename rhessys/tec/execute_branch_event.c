@@ -0,0 +1,329 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					execute_branch_event						*/
+/*																*/
+/*	execute_branch_event - forks one child per scenario of		*/
+/*			the -branch table									*/
+/*																*/
+/*	NAME														*/
+/*	execute_branch_event - forks one child per scenario of		*/
+/*			the -branch table									*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	int execute_branch_event(									*/
+/*			struct	tec_object	*tecfile,						*/
+/*			struct	command_line_object	*command_line,			*/
+/*			struct	world_output_file_object	*outfile,		*/
+/*			struct	world_output_file_object	*growth_outfile,*/
+/*			struct	date	current_date)						*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Called by execute_tec for a branch tec event.  The table	*/
+/*	given with -branch has one scenario per line:				*/
+/*																*/
+/*		label	tecfile											*/
+/*																*/
+/*	e.g.														*/
+/*		fire_2030	scenarios/fire_2030.tec						*/
+/*		roads		scenarios/roads.tec							*/
+/*		control		scenarios/empty.tec							*/
+/*																*/
+/*	Text following a # is a comment.  Each tec file holds the	*/
+/*	events of the scenario after the branch date, in the		*/
+/*	usual tec format; it may be empty.							*/
+/*																*/
+/*	One child is forked per scenario, at most					*/
+/*	command_line.branch_jobs at a time (default the number of	*/
+/*	online processors).  The child shares the simulated world	*/
+/*	with the parent copy-on-write; it replaces the rest of the	*/
+/*	tec file with the scenario tec file, opens its own output	*/
+/*	files under <prefix>_<label> (with headers), sends stdout	*/
+/*	to <prefix>_<label>.log and returns 1 so execute_tec goes	*/
+/*	on from the branch date.									*/
+/*																*/
+/*	The parent returns 0 once all scenarios have finished, and	*/
+/*	execute_tec stops: the parent's output files then hold		*/
+/*	the shared history up to the branch date.  The parent		*/
+/*	exits with failure if any scenario failed.					*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*	Scenario events dated before the branch date are run at		*/
+/*	the branch date.  Scenario tec files are not checked up		*/
+/*	front by construct_tec, so a bad command is only reported	*/
+/*	by the child that reads it.  A branch event inside a		*/
+/*	scenario tec file is an error.  Scenario tec files should	*/
+/*	not hold output_checkpoint events: the checkpoint would		*/
+/*	record a position in the scenario tec file, not the -t file.*/
+/*	Output files are flushed before forking so that buffered	*/
+/*	output is written once, by the parent.						*/
+/*																*/
+/*--------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200112L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include "rhessys.h"
+
+static int read_branch_table(char *branch_filename,
+							 char ***labels,
+							 char ***tec_filenames)
+{
+	void	*alloc( size_t, char *, char * );
+	int	i, num_lines, num_scenarios, line_number;
+	char	line[MAXSTR];
+	char	*label, *tec_filename, *comment;
+	FILE	*branch_file;
+
+	if ( (branch_file = fopen(branch_filename, "r")) == NULL ){
+		fprintf(stderr,"FATAL ERROR: Unable to open branch table %s\n",
+			branch_filename);
+		exit(EXIT_FAILURE);
+	}
+	num_lines = 0;
+	while ( fgets(line, MAXSTR, branch_file) != NULL )
+		num_lines++;
+	rewind(branch_file);
+	*labels = (char **) alloc((num_lines + 1) * sizeof(char *),
+		"labels","execute_branch_event");
+	*tec_filenames = (char **) alloc((num_lines + 1) * sizeof(char *),
+		"tec_filenames","execute_branch_event");
+	num_scenarios = 0;
+	line_number = 0;
+	while ( fgets(line, MAXSTR, branch_file) != NULL ){
+		line_number++;
+		if ( (comment = strchr(line, '#')) != NULL )
+			*comment = '\0';
+		if ( (label = strtok(line, " \t\r\n")) == NULL )
+			continue;
+		if ( ((tec_filename = strtok(NULL, " \t\r\n")) == NULL)
+			|| (strtok(NULL, " \t\r\n") != NULL) ){
+			fprintf(stderr,
+				"FATAL ERROR: branch table %s line %d: expected label and tec file\n",
+				branch_filename, line_number);
+			exit(EXIT_FAILURE);
+		}
+		for (i=0; i < num_scenarios; i++)
+			if ( strcmp(label, (*labels)[i]) == 0 ){
+				fprintf(stderr,
+					"FATAL ERROR: branch table %s line %d: scenario %s given twice\n",
+					branch_filename, line_number, label);
+				exit(EXIT_FAILURE);
+			}
+		(*labels)[num_scenarios] = (char *) alloc((strlen(label) + 1) * sizeof(char),
+			"labels","execute_branch_event");
+		strcpy((*labels)[num_scenarios], label);
+		(*tec_filenames)[num_scenarios] = (char *)
+			alloc((strlen(tec_filename) + 1) * sizeof(char),
+			"tec_filenames","execute_branch_event");
+		strcpy((*tec_filenames)[num_scenarios], tec_filename);
+		num_scenarios++;
+	}
+	fclose(branch_file);
+	if ( num_scenarios == 0 ){
+		fprintf(stderr,"FATAL ERROR: branch table %s has no scenarios\n",
+			branch_filename);
+		exit(EXIT_FAILURE);
+	}
+	return(num_scenarios);
+}
+
+int	execute_branch_event(
+						 struct	tec_object	*tecfile,
+						 struct	command_line_object	*command_line,
+						 struct	world_output_file_object	*outfile,
+						 struct	world_output_file_object	*growth_outfile,
+						 struct	date	current_date)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local function definition.									*/
+	/*--------------------------------------------------------------*/
+	void	*alloc( size_t, char *, char * );
+
+	struct	world_output_file_object	*construct_output_files(
+		char *,
+		struct command_line_object * );
+
+	void	add_headers(
+		struct world_output_file_object *,
+		struct command_line_object * );
+
+	void	add_growth_headers(
+		struct world_output_file_object *,
+		struct command_line_object * );
+
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	int	c, j, s, num_scenarios, running, finished, num_failed, status;
+	pid_t	pid;
+	pid_t	*pids;
+	char	prefix[MAXSTR];
+	char	logname[MAXSTR + 5];	/* prefix and ".log" */
+	char	**labels, **tec_filenames;
+	FILE	*scenario_tfile;
+	struct	world_output_file_object	*scenario_output;
+
+	if (command_line[0].branch_flag == 0){
+		fprintf(stderr,
+			"FATAL ERROR: branch event on %ld %ld %ld without -branch (or inside a scenario tec file)\n",
+			current_date.year, current_date.month, current_date.day);
+		exit(EXIT_FAILURE);
+	}
+	if (command_line[0].spinup_flag == 1){
+		fprintf(stderr,"FATAL ERROR: branch events cannot be used with -spinup\n");
+		exit(EXIT_FAILURE);
+	}
+	num_scenarios = read_branch_table(command_line[0].branch_filename,
+		&labels, &tec_filenames);
+	if (command_line[0].branch_jobs <= 0)
+		command_line[0].branch_jobs = (int) sysconf(_SC_NPROCESSORS_ONLN);
+	if (command_line[0].branch_jobs <= 0)
+		command_line[0].branch_jobs = 1;
+	pids = (pid_t *) alloc(num_scenarios * sizeof(pid_t),
+		"pids","execute_branch_event");
+	printf("\n Branching %d scenarios on %ld %ld %ld, %d at a time\n",
+		num_scenarios, current_date.year, current_date.month,
+		current_date.day, command_line[0].branch_jobs);
+
+	running = 0;
+	finished = 0;
+	num_failed = 0;
+	for (s=0; s <= num_scenarios; s++){
+		/*--------------------------------------------------------------*/
+		/*	wait for a free slot (or, after the last fork, for all)		*/
+		/*--------------------------------------------------------------*/
+		while ( (running > 0) && ((running >= command_line[0].branch_jobs)
+			|| (s == num_scenarios)) ){
+			if ( (pid = wait(&status)) < 0 ){
+				perror("execute_branch_event: wait");
+				exit(EXIT_FAILURE);
+			}
+			running--;
+			finished++;
+			for (j=0; j < s; j++)
+				if (pids[j] == pid)
+					break;
+			if ( !WIFEXITED(status) || (WEXITSTATUS(status) != EXIT_SUCCESS) ){
+				num_failed++;
+				fprintf(stderr,"branch scenario %s failed\n",
+					(j < s) ? labels[j] : "?");
+			}
+			printf("\n Branch scenario %s finished (%d of %d)",
+				(j < s) ? labels[j] : "?", finished, num_scenarios);
+			fflush(stdout);
+		}
+		if (s == num_scenarios)
+			break;
+		/*--------------------------------------------------------------*/
+		/*	flush so buffered output is not repeated by the child		*/
+		/*--------------------------------------------------------------*/
+		fflush(NULL);
+		if ( (pid = fork()) < 0 ){
+			perror("execute_branch_event: fork");
+			exit(EXIT_FAILURE);
+		}
+		if (pid == 0){
+			/*--------------------------------------------------------------*/
+			/*	the scenario tec file becomes the rest of the tec file		*/
+			/*--------------------------------------------------------------*/
+			if ( (scenario_tfile = fopen(tec_filenames[s], "r")) == NULL ){
+				fprintf(stderr,"FATAL ERROR: Unable to open scenario tec file %s\n",
+					tec_filenames[s]);
+				exit(EXIT_FAILURE);
+			}
+			/*--------------------------------------------------------------*/
+			/*	the -t file is left open: closing it could move the file	*/
+			/*	offset it shares with the parent							*/
+			/*--------------------------------------------------------------*/
+			tecfile[0].tfile = scenario_tfile;
+			/*--------------------------------------------------------------*/
+			/*	skip leading white space so an empty file reads as ended	*/
+			/*--------------------------------------------------------------*/
+			while ( ((c = fgetc(tecfile[0].tfile)) != EOF) && isspace(c) )
+				;
+			if (c != EOF)
+				ungetc(c, tecfile[0].tfile);
+			command_line[0].branch_flag = 0;
+			/*--------------------------------------------------------------*/
+			/*	scenario output files and log								*/
+			/*--------------------------------------------------------------*/
+			/*--------------------------------------------------------------*/
+			/*	leave room in prefix for the _grow suffix					*/
+			/*--------------------------------------------------------------*/
+			if ( snprintf(prefix, MAXSTR - 5, "%s_%s",
+				(command_line[0].output_prefix != NULL) ?
+				command_line[0].output_prefix : PRE, labels[s])
+				>= MAXSTR - 5 ){
+				fprintf(stderr,
+					"FATAL ERROR: Output prefix for branch scenario %s too long\n",
+					labels[s]);
+				exit(EXIT_FAILURE);
+			}
+			snprintf(logname, sizeof(logname), "%s.log", prefix);
+			if ( freopen(logname, "w", stdout) == NULL ){
+				fprintf(stderr,"FATAL ERROR: Unable to open branch log %s\n",
+					logname);
+				exit(EXIT_FAILURE);
+			}
+			printf("Branch scenario %s of %s from %ld %ld %ld\n", labels[s],
+				command_line[0].branch_filename, current_date.year,
+				current_date.month, current_date.day);
+			command_line[0].output_prefix = (char *)
+				alloc((strlen(prefix) + 1) * sizeof(char),
+				"output_prefix","execute_branch_event");
+			strcpy(command_line[0].output_prefix, prefix);
+			if ( (command_line[0].telemetry != NULL)
+				&& (command_line[0].telemetry[0].status_filename != NULL) ){
+				if ( snprintf(logname, sizeof(logname), "%s_%s",
+					command_line[0].telemetry[0].status_filename, labels[s])
+					>= (int) sizeof(logname) ){
+					fprintf(stderr,
+						"FATAL ERROR: Status file for branch scenario %s too long\n",
+						labels[s]);
+					exit(EXIT_FAILURE);
+				}
+				command_line[0].telemetry[0].status_filename = (char *)
+					alloc((strlen(logname) + 1) * sizeof(char),
+					"status_filename","execute_branch_event");
+				strcpy(command_line[0].telemetry[0].status_filename, logname);
+			}
+			scenario_output = construct_output_files(prefix, command_line);
+			if ( (outfile != NULL) && (scenario_output != NULL) ){
+				add_headers(scenario_output, command_line);
+				outfile[0] = scenario_output[0];
+			}
+			if (command_line[0].grow_flag > 0){
+				strcat(prefix, "_grow");
+				scenario_output = construct_output_files(prefix, command_line);
+				if ( (growth_outfile != NULL) && (scenario_output != NULL) ){
+					add_growth_headers(scenario_output, command_line);
+					growth_outfile[0] = scenario_output[0];
+				}
+			}
+			free(pids);
+			return(1);
+		}
+		pids[s] = pid;
+		running++;
+	}
+	printf("\n %d of %d branch scenarios completed\n",
+		num_scenarios - num_failed, num_scenarios);
+	if (num_failed > 0)
+		exit(EXIT_FAILURE);
+	free(pids);
+	for (s=0; s < num_scenarios; s++){
+		free(labels[s]);
+		free(tec_filenames[s]);
+	}
+	free(labels);
+	free(tec_filenames);
+	return(0);
+} /*end execute_branch_event*/
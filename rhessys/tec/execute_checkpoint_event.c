@@ -0,0 +1,248 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					execute_checkpoint_event					*/
+/*																*/
+/*	execute_checkpoint_event - writes a binary checkpoint		*/
+/*																*/
+/*	NAME														*/
+/*	execute_checkpoint_event - writes a binary checkpoint		*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	void	execute_checkpoint_event(							*/
+/*					struct	world_object	*world,				*/
+/*					struct	command_line_object *command_line,	*/
+/*					struct	date	current_date,				*/
+/*					struct	date	next_date,					*/
+/*					long	tec_offset)							*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Triggered by the output_checkpoint tec event.  Writes		*/
+/*	world_filename.YyyyyMmDdHh.ckpt holding every piece of		*/
+/*	in-memory state that changes during a run, so that a		*/
+/*	run started with -restart on the same world, flow table,	*/
+/*	climate and tec file continues bit-identically.				*/
+/*																*/
+/*	The file holds a checkpoint_header (dates, output flags,	*/
+/*	tec file position and struct sizes) followed by:			*/
+/*		world declination terms									*/
+/*		default object arrays									*/
+/*		base station dated sequence cursors						*/
+/*		basins, stream reaches, hillslopes, zones, patches		*/
+/*		(with their canopy layers) and strata, in world order	*/
+/*	Objects are written as raw structs; pointer members are		*/
+/*	restored from the freshly constructed world on reading.		*/
+/*	The default object each object uses is stored as an index	*/
+/*	since redefine events may re-point it.						*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*	Static inputs (climate arrays, routing topology, default	*/
+/*	grow parameters) are rebuilt on construction, not saved.	*/
+/*	The random seed is saved so -restart repeats the draws.		*/
+/*	The checkpoint is only valid for the binary that wrote it.	*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rhessys.h"
+
+static void write_checkpoint_block(FILE *outfile, void *block, size_t size)
+{
+	if ( (size > 0) && (fwrite(block, size, 1, outfile) != 1) ){
+		fprintf(stderr,"FATAL ERROR: Unable to write checkpoint file\n");
+		exit(EXIT_FAILURE);
+	}
+}
+
+void	execute_checkpoint_event(
+								 struct	world_object	*world,
+								 struct	command_line_object *command_line,
+								 struct	date	current_date,
+								 struct	date	next_date,
+								 long	tec_offset)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	int	b, h, z, p, c, i;
+	int	index[5];
+	FILE	*outfile;
+	char	filename[MAXSTR+100];
+	char	ext[20];
+	struct	checkpoint_header	header;
+	struct	default_object	*defaults;
+	struct	basin_object	*basin;
+	struct	hillslope_object	*hillslope;
+	struct	zone_object	*zone;
+	struct	patch_object	*patch;
+	struct	canopy_strata_object	*stratum;
+	struct	base_station_object	*base_station;
+
+	sprintf(ext,".Y%4ldM%ldD%ldH%ld",current_date.year,
+		current_date.month,
+		current_date.day,
+		current_date.hour);
+	strcpy(filename, command_line[0].world_filename);
+	strcat(filename, ext);
+	strcat(filename, ".ckpt");
+	if ( ( outfile = fopen(filename, "wb")) == NULL ){
+		fprintf(stderr,"FATAL ERROR: Unable to open checkpoint file %s\n",
+			filename);
+		exit(EXIT_FAILURE);
+	}
+	/*--------------------------------------------------------------*/
+	/*	header														*/
+	/*--------------------------------------------------------------*/
+	memset(&header, 0, sizeof(struct checkpoint_header));
+	strcpy(header.magic, CHECKPOINT_MAGIC);
+	header.version = CHECKPOINT_VERSION;
+	header.num_basins = world[0].num_basin_files;
+	header.struct_sizes[0] = sizeof(struct world_object);
+	header.struct_sizes[1] = sizeof(struct basin_object);
+	header.struct_sizes[2] = sizeof(struct hillslope_object);
+	header.struct_sizes[3] = sizeof(struct zone_object);
+	header.struct_sizes[4] = sizeof(struct patch_object);
+	header.struct_sizes[5] = sizeof(struct canopy_strata_object);
+	header.tec_offset = tec_offset;
+	header.seed = command_line[0].seed;
+	header.current_date = current_date;
+	header.next_date = next_date;
+	header.output_flags = command_line[0].output_flags;
+	header.output_yearly_date = command_line[0].output_yearly_date;
+	write_checkpoint_block(outfile, &header, sizeof(struct checkpoint_header));
+	/*--------------------------------------------------------------*/
+	/*	world														*/
+	/*--------------------------------------------------------------*/
+	write_checkpoint_block(outfile, &(world[0].year_day), sizeof(int));
+	write_checkpoint_block(outfile, &(world[0].declin), sizeof(double));
+	write_checkpoint_block(outfile, &(world[0].cos_declin), sizeof(double));
+	write_checkpoint_block(outfile, &(world[0].sin_declin), sizeof(double));
+	write_checkpoint_block(outfile, &(world[0].Io), sizeof(double));
+	/*--------------------------------------------------------------*/
+	/*	defaults													*/
+	/*--------------------------------------------------------------*/
+	defaults = world[0].defaults;
+	write_checkpoint_block(outfile, defaults[0].basin,
+		defaults[0].num_basin_default_files * sizeof(struct basin_default));
+	write_checkpoint_block(outfile, defaults[0].hillslope,
+		defaults[0].num_hillslope_default_files * sizeof(struct hillslope_default));
+	write_checkpoint_block(outfile, defaults[0].zone,
+		defaults[0].num_zone_default_files * sizeof(struct zone_default));
+	write_checkpoint_block(outfile, defaults[0].soil,
+		defaults[0].num_soil_default_files * sizeof(struct soil_default));
+	write_checkpoint_block(outfile, defaults[0].landuse,
+		defaults[0].num_landuse_default_files * sizeof(struct landuse_default));
+	write_checkpoint_block(outfile, defaults[0].stratum,
+		defaults[0].num_stratum_default_files * sizeof(struct stratum_default));
+	if (command_line[0].firespread_flag == 1)
+		write_checkpoint_block(outfile, defaults[0].fire,
+			defaults[0].num_fire_default_files * sizeof(struct fire_default));
+	if (command_line[0].surface_energy_flag == 1)
+		write_checkpoint_block(outfile, defaults[0].surface_energy,
+			defaults[0].num_surface_energy_default_files
+			* sizeof(struct surface_energy_default));
+	/*--------------------------------------------------------------*/
+	/*	basins														*/
+	/*--------------------------------------------------------------*/
+	for (b=0; b < world[0].num_basin_files; b++){
+		basin = world[0].basins[b];
+		write_checkpoint_block(outfile, basin, sizeof(struct basin_object));
+		index[0] = (int) (basin[0].defaults[0] - defaults[0].basin);
+		write_checkpoint_block(outfile, index, sizeof(int));
+		if ( (command_line[0].grow_flag > 0) && (basin[0].grow != NULL) )
+			write_checkpoint_block(outfile, basin[0].grow,
+				sizeof(struct grow_basin_object));
+		if (command_line[0].routing_flag == 1)
+			write_checkpoint_block(outfile, basin[0].outside_region,
+				sizeof(struct patch_object));
+		if (command_line[0].stream_routing_flag == 1)
+			write_checkpoint_block(outfile, basin[0].stream_list.stream_network,
+				basin[0].stream_list.num_reaches
+				* sizeof(struct stream_network_object));
+		/*--------------------------------------------------------------*/
+		/*	hillslopes													*/
+		/*--------------------------------------------------------------*/
+		for (h=0; h < basin[0].num_hillslopes; h++){
+			hillslope = basin[0].hillslopes[h];
+			write_checkpoint_block(outfile, hillslope,
+				sizeof(struct hillslope_object));
+			index[0] = (int) (hillslope[0].defaults[0] - defaults[0].hillslope);
+			write_checkpoint_block(outfile, index, sizeof(int));
+			if ( (command_line[0].grow_flag > 0) && (hillslope[0].grow != NULL) )
+				write_checkpoint_block(outfile, hillslope[0].grow,
+					sizeof(struct grow_hillslope_object));
+			/*--------------------------------------------------------------*/
+			/*	zones and their hourly rain cursors							*/
+			/*--------------------------------------------------------------*/
+			for (z=0; z < hillslope[0].num_zones; z++){
+				zone = hillslope[0].zones[z];
+				write_checkpoint_block(outfile, zone, sizeof(struct zone_object));
+				write_checkpoint_block(outfile, zone[0].hourly,
+					sizeof(struct zone_hourly_object));
+				index[0] = (int) (zone[0].defaults[0] - defaults[0].zone);
+				write_checkpoint_block(outfile, index, sizeof(int));
+				if (zone[0].base_stations != NULL){
+					base_station = zone[0].base_stations[0];
+					index[0] = base_station[0].hourly_clim[0].rain.inx;
+					index[1] = base_station[0].hourly_clim[0].rain_duration.inx;
+					write_checkpoint_block(outfile, index, 2 * sizeof(int));
+				}
+				/*--------------------------------------------------------------*/
+				/*	patches, their dated input cursors and canopy layers		*/
+				/*--------------------------------------------------------------*/
+				for (p=0; p < zone[0].num_patches; p++){
+					patch = zone[0].patches[p];
+					write_checkpoint_block(outfile, patch,
+						sizeof(struct patch_object));
+					write_checkpoint_block(outfile, patch[0].hourly,
+						sizeof(struct patch_hourly_object));
+					index[0] = (int) (patch[0].soil_defaults[0] - defaults[0].soil);
+					index[1] = (int) (patch[0].landuse_defaults[0]
+						- defaults[0].landuse);
+					index[2] = (command_line[0].firespread_flag == 1) ?
+						(int) (patch[0].fire_defaults[0] - defaults[0].fire) : 0;
+					index[3] = (command_line[0].surface_energy_flag == 1) ?
+						(int) (patch[0].surface_energy_defaults[0]
+						- defaults[0].surface_energy) : 0;
+					write_checkpoint_block(outfile, index, 4 * sizeof(int));
+					if (patch[0].base_stations != NULL){
+						base_station = patch[0].base_stations[0];
+						index[0] = base_station[0].dated_input[0].fertilizer_NO3.inx;
+						index[1] = base_station[0].dated_input[0].fertilizer_NH4.inx;
+						index[2] = base_station[0].dated_input[0].irrigation.inx;
+						index[3] = base_station[0].dated_input[0].PH.inx;
+						index[4] = base_station[0].dated_input[0].grazing_Closs.inx;
+						write_checkpoint_block(outfile, index, 5 * sizeof(int));
+					}
+					if (command_line[0].surface_energy_flag == 1)
+						write_checkpoint_block(outfile,
+							patch[0].surface_energy_profile,
+							4 * sizeof(struct surface_energy_object));
+					for (i=0; i < patch[0].num_layers; i++){
+						write_checkpoint_block(outfile, &(patch[0].layers[i]),
+							sizeof(struct layer_object));
+						write_checkpoint_block(outfile, patch[0].layers[i].strata,
+							patch[0].layers[i].count * sizeof(long));
+					}
+					/*--------------------------------------------------------------*/
+					/*	strata														*/
+					/*--------------------------------------------------------------*/
+					for (c=0; c < patch[0].num_canopy_strata; c++){
+						stratum = patch[0].canopy_strata[c];
+						write_checkpoint_block(outfile, stratum,
+							sizeof(struct canopy_strata_object));
+						index[0] = (int) (stratum[0].defaults[0]
+							- defaults[0].stratum);
+						write_checkpoint_block(outfile, index, sizeof(int));
+					}
+				}
+			}
+		}
+	}
+	fclose(outfile);
+	return;
+} /*end execute_checkpoint_event*/
@@ -78,11 +78,25 @@ void	execute_daily_output_event(
 		struct	stream_network_object *,
 		struct	date,
 		FILE	*);
+	struct	output_schema_entry	*find_schema_entry(
+		struct command_line_object *, int, int);
+
+	void	output_schema_record(
+		struct	output_schema_entry *,
+		int, int *, void *, int,
+		struct	date,
+		FILE	*);
 	/*--------------------------------------------------------------*/
 	/*	Local variable definition.									*/
 	/*--------------------------------------------------------------*/
 	int	basinID, hillID, patchID, zoneID, stratumID,reachID;
 	int b,h,p,z,c,s;
+	int	ids[5];
+	struct	output_schema_entry	*zone_schema, *patch_schema, *stratum_schema;
+
+	zone_schema = find_schema_entry(command_line, SCHEMA_ZONE, SCHEMA_DAILY);
+	patch_schema = find_schema_entry(command_line, SCHEMA_PATCH, SCHEMA_DAILY);
+	stratum_schema = find_schema_entry(command_line, SCHEMA_STRATUM, SCHEMA_DAILY);
 	/*--------------------------------------------------------------*/
 	/*	check to see if there are any print options					*/
 	/*--------------------------------------------------------------*/
@@ -175,12 +189,22 @@ void	execute_daily_output_event(
 									if (( world[0].basins[b][0].hillslopes[h][0].ID == hillID)
 										|| (hillID == -999))
 										if (( world[0].basins[b][0].hillslopes[h][0].zones[z][0].ID == zoneID)
-											|| (zoneID == -999))
+											|| (zoneID == -999)){
+											if (zone_schema != NULL){
+												ids[0] = world[0].basins[b][0].ID;
+												ids[1] = world[0].basins[b][0].hillslopes[h][0].ID;
+												ids[2] = world[0].basins[b][0].hillslopes[h][0].zones[z][0].ID;
+												output_schema_record(zone_schema, 3, ids,
+													world[0].basins[b]->hillslopes[h]->zones[z],
+													0, date, outfile->zone->daily);
+											}
+											else
 											output_zone(
 											world[0].basins[b][0].ID,
 											world[0].basins[b][0].hillslopes[h][0].ID,
 											world[0].basins[b]->hillslopes[h]->zones[z],
 											date, outfile->zone->daily);
+										}
 							}
 							/*-------------------------------------------------------*/
 							/*	check to see if there are any lower print options		*/
@@ -209,6 +233,16 @@ void	execute_daily_output_event(
 													|| (zoneID == -999))
 													if (( world[0].basins[b][0].hillslopes[h][0].zones[z][0].patches[p][0].ID == patchID)
 														|| (patchID == -999)){
+														if (patch_schema != NULL){
+															ids[0] = world[0].basins[b][0].ID;
+															ids[1] = world[0].basins[b][0].hillslopes[h][0].ID;
+															ids[2] = world[0].basins[b][0].hillslopes[h][0].zones[z][0].ID;
+															ids[3] = world[0].basins[b][0].hillslopes[h][0].zones[z][0].patches[p][0].ID;
+															output_schema_record(patch_schema, 4, ids,
+																world[0].basins[b]->hillslopes[h]->zones[z]->patches[p],
+																0, date, outfile->patch->daily);
+														}
+														else
 														output_patch(
 															world[0].basins[b]->ID,
 															world[0].basins[b]->hillslopes[h]->ID,
@@ -243,7 +277,18 @@ void	execute_daily_output_event(
 														if (( world[0].basins[b][0].hillslopes[h][0].zones[z][0].patches[p][0].ID == patchID)
 															||	(patchID == -999))
 															if (( world[0].basins[b][0].hillslopes[h][0].zones[z][0].patches[p][0].canopy_strata[c][0].ID == stratumID)
-																|| (stratumID == -999))
+																|| (stratumID == -999)){
+																if (stratum_schema != NULL){
+																	ids[0] = world[0].basins[b][0].ID;
+																	ids[1] = world[0].basins[b][0].hillslopes[h][0].ID;
+																	ids[2] = world[0].basins[b][0].hillslopes[h][0].zones[z][0].ID;
+																	ids[3] = world[0].basins[b][0].hillslopes[h][0].zones[z][0].patches[p][0].ID;
+																	ids[4] = world[0].basins[b][0].hillslopes[h][0].zones[z][0].patches[p][0].canopy_strata[c][0].ID;
+																	output_schema_record(stratum_schema, 5, ids,
+																		world[0].basins[b]->hillslopes[h]->zones[z]->patches[p]->canopy_strata[c],
+																		0, date, outfile->canopy_stratum->daily);
+																}
+																else
 																output_canopy_stratum(
 																world[0].basins[b][0].ID,
 																world[0].basins[b][0].hillslopes[h][0].ID,
@@ -251,6 +296,7 @@ void	execute_daily_output_event(
 																world[0].basins[b][0].hillslopes[h][0].zones[z][0].patches[p][0].ID,
 																world[0].basins[b]->hillslopes[h]->zones[z]->patches[p]->canopy_strata[c],
 																date, outfile->canopy_stratum->daily);
+															}
 										} /* end stratum (c) for loop */
 									} /* end if options */
 								} /* end patch (p) for loop */
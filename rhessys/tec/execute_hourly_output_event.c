@@ -69,11 +69,25 @@ void	execute_hourly_output_event(
 		struct	canopy_strata_object *,
 		struct	date,
 		FILE	*);
+	struct	output_schema_entry	*find_schema_entry(
+		struct command_line_object *, int, int);
+
+	void	output_schema_record(
+		struct	output_schema_entry *,
+		int, int *, void *, int,
+		struct	date,
+		FILE	*);
 	/*--------------------------------------------------------------*/
 	/*	Local variable definition.									*/
 	/*--------------------------------------------------------------*/
 	int	basinID, hillID, patchID, zoneID, stratumID;
 	int b,h,p,z,c;
+	int	ids[5];
+	struct	output_schema_entry	*zone_schema, *patch_schema, *stratum_schema;
+
+	zone_schema = find_schema_entry(command_line, SCHEMA_ZONE, SCHEMA_HOURLY);
+	patch_schema = find_schema_entry(command_line, SCHEMA_PATCH, SCHEMA_HOURLY);
+	stratum_schema = find_schema_entry(command_line, SCHEMA_STRATUM, SCHEMA_HOURLY);
 	/*--------------------------------------------------------------*/
 	/*	check to see if there are any print options					*/
 	/*--------------------------------------------------------------*/
@@ -146,13 +160,23 @@ void	execute_hourly_output_event(
 									if (( world[0].basins[b][0].hillslopes[h][0].ID == hillID)
 										|| (hillID == -999))
 										if (( world[0].basins[b][0].hillslopes[h][0].zones[z][0].ID == zoneID)
-											|| (zoneID == -999))
+											|| (zoneID == -999)){
+											if (zone_schema != NULL){
+												ids[0] = world[0].basins[b][0].ID;
+												ids[1] = world[0].basins[b][0].hillslopes[h][0].ID;
+												ids[2] = world[0].basins[b][0].hillslopes[h][0].zones[z][0].ID;
+												output_schema_record(zone_schema, 3, ids,
+													world[0].basins[b]->hillslopes[h]->zones[z],
+													1, date, outfile->zone->hourly);
+											}
+											else
 											output_hourly_zone(
 											world[0].basins[b][0].ID,
 											world[0].basins[b][0].hillslopes[h][0].ID,
 											world[0].basins[b]->hillslopes[h]->zones[z],
 											date,
 											outfile->zone->hourly);
+										}
 							}
 							/*------------------------------------------------------*/
 							/*	check to see if there are any lower print options	  */
@@ -180,7 +204,17 @@ void	execute_hourly_output_event(
 												if (( world[0].basins[b][0].hillslopes[h][0].zones[z][0].ID == zoneID)
 													|| (zoneID == -999))
 													if (( world[0].basins[b][0].hillslopes[h][0].zones[z][0].patches[p][0].ID == patchID)
-														|| (patchID == -999))
+														|| (patchID == -999)){
+														if (patch_schema != NULL){
+															ids[0] = world[0].basins[b][0].ID;
+															ids[1] = world[0].basins[b][0].hillslopes[h][0].ID;
+															ids[2] = world[0].basins[b][0].hillslopes[h][0].zones[z][0].ID;
+															ids[3] = world[0].basins[b][0].hillslopes[h][0].zones[z][0].patches[p][0].ID;
+															output_schema_record(patch_schema, 4, ids,
+																world[0].basins[b]->hillslopes[h]->zones[z]->patches[p],
+																1, date, outfile->patch->hourly);
+														}
+														else
 														output_patch(
 														world[0].basins[b]->ID,
 														world[0].basins[b]->hillslopes[h]->ID,
@@ -189,6 +223,7 @@ void	execute_hourly_output_event(
 														world[0].basins[b]->hillslopes[h]->zones[z],
 														date,
 														outfile->patch->hourly);
+													}
 									}
 									/*-----------------------------------------------*/
 									/*	Construct the canopy_stratum output files		 */
@@ -214,7 +249,18 @@ void	execute_hourly_output_event(
 														if (( world[0].basins[b][0].hillslopes[h][0].zones[z][0].patches[p][0].ID == patchID)
 															|| (patchID == -999))
 															if (( world[0].basins[b][0].hillslopes[h][0].zones[z][0].patches[p][0].canopy_strata[c][0].ID == stratumID)
-																|| (stratumID == -999))
+																|| (stratumID == -999)){
+																if (stratum_schema != NULL){
+																	ids[0] = world[0].basins[b][0].ID;
+																	ids[1] = world[0].basins[b][0].hillslopes[h][0].ID;
+																	ids[2] = world[0].basins[b][0].hillslopes[h][0].zones[z][0].ID;
+																	ids[3] = world[0].basins[b][0].hillslopes[h][0].zones[z][0].patches[p][0].ID;
+																	ids[4] = world[0].basins[b][0].hillslopes[h][0].zones[z][0].patches[p][0].canopy_strata[c][0].ID;
+																	output_schema_record(stratum_schema, 5, ids,
+																		world[0].basins[b]->hillslopes[h]->zones[z]->patches[p]->canopy_strata[c],
+																		1, date, outfile->canopy_stratum->hourly);
+																}
+																else
 																output_canopy_stratum(
 																world[0].basins[b][0].ID,
 																world[0].basins[b][0].hillslopes[h][0].ID,
@@ -223,6 +269,7 @@ void	execute_hourly_output_event(
 																world[0].basins[b]->hillslopes[h]->zones[z]->patches[p]->canopy_strata[c],
 																date,
 																outfile->canopy_stratum->hourly);
+															}
 										} /* end stratum (c) for loop */
 									} /* end if options */
 								} /* end patch (p) for loop */
@@ -62,6 +62,7 @@ void	execute_redefine_world_mult_event(struct world_object *world,
 		struct base_station_object **,
 		struct default_object *,
 		struct hillslope_object *);
+	void	construct_solar_ephemeris( struct basin_object * );
 	void input_new_basin_mult( struct command_line_object *,
 		FILE *,
 		int,
@@ -399,6 +400,13 @@ void	execute_redefine_world_mult_event(struct world_object *world,
 		
 		} /*end basin loop */
 	
+	/*--------------------------------------------------------------*/
+	/*	Latitude, slopes and aspects may have changed, so		*/
+	/*	tabulate the solar geometry again.						*/
+	/*--------------------------------------------------------------*/
+	for (b=0; b < world[0].num_basin_files; b++)
+		construct_solar_ephemeris(world[0].basins[b]);
+	
 	/*--------------------------------------------------------------*/
 	/*	Close the world_input_file.										*/
 	/*--------------------------------------------------------------*/
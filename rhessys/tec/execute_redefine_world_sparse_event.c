@@ -0,0 +1,290 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*				execute_redefine_world_sparse_event				*/
+/*																*/
+/*	execute_redefine_world_sparse_event - resets state of the	*/
+/*			objects listed in a sparse redefine file			*/
+/*																*/
+/*	NAME														*/
+/*	execute_redefine_world_sparse_event - resets state of the	*/
+/*			objects listed in a sparse redefine file			*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	void execute_redefine_world_sparse_event(					*/
+/*					struct	world_object	*world,				*/
+/*					struct	command_line_object *command_line,	*/
+/*					struct	date	current_date)				*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Triggered by the redefine_world_sparse tec event.  Reads	*/
+/*	world_filename.YyyyyMmDdHh (as redefine_world does) but		*/
+/*	the file lists only the objects that change, so the cost	*/
+/*	is proportional to the number of values set rather than	*/
+/*	to the size of the world.									*/
+/*																*/
+/*	Text form - one object per line, # starts a comment:		*/
+/*																*/
+/*		<zone|patch|stratum> ID name value [name value ...]		*/
+/*		patch	1002101	sat_deficit 0.4 litter_cs.litr1c 0.0	*/
+/*		stratum	100210101	cs.leafc 0.05 cs.live_stemc 0.2		*/
+/*																*/
+/*	Binary form - starts with SPARSE_REDEFINE_MAGIC padded to	*/
+/*	16 bytes, then:												*/
+/*		int	num_fields											*/
+/*		num_fields x { int level;								*/
+/*				char name[SPARSE_REDEFINE_NAME_LEN]; }			*/
+/*		int	num_records											*/
+/*		num_records x struct sparse_redefine_record				*/
+/*	where level is SCHEMA_ZONE, SCHEMA_PATCH or SCHEMA_STRATUM.	*/
+/*																*/
+/*	Names are those of the output schema registry				*/
+/*	(find_output_variable), and only its state entries, the	*/
+/*	patch and stratum water, snow, C and N stores, can be		*/
+/*	set.  Geometry (area, slope, aspect, z), forcing, fluxes	*/
+/*	and derived values are rejected, since the tables and		*/
+/*	routing terms built from them at construction would not	*/
+/*	follow; use redefine_world for those.						*/
+/*	IDs are resolved through the index built by					*/
+/*	construct_redefine_index.  IDs not in this world are		*/
+/*	skipped, as redefine_world skips unknown objects.			*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*	Values are assigned as given; unlike input_new_patch no	*/
+/*	N pools are derived from C pools.  After a patch value is	*/
+/*	set the litter interception capacity and sat_deficit_z		*/
+/*	are recomputed.												*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rhessys.h"
+
+static void apply_sparse_value(struct world_object *world,
+							   struct command_line_object *command_line,
+							   int level,
+							   int ID,
+							   struct output_variable *variable,
+							   double value,
+							   int *num_skipped)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local function definition.									*/
+	/*--------------------------------------------------------------*/
+	struct	redefine_index_entry	*find_redefine_entry(
+		struct redefine_index_object *,
+		int,
+		int);
+	double	compute_z_final( int, double, double, double, double, double);
+	void	update_litter_interception_capacity( double,
+		double,
+		struct litter_c_object *,
+		struct litter_object *);
+
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	struct	redefine_index_entry	*entry;
+	struct	patch_object	*patch;
+
+	if ( (entry = find_redefine_entry(world[0].redefine_index, level, ID)) == NULL ){
+		*num_skipped += 1;
+		return;
+	}
+	*((double *) ((char *) entry[0].object + variable[0].offset)) = value;
+	patch = entry[0].patch;
+	if (level == SCHEMA_PATCH){
+		update_litter_interception_capacity(
+			patch[0].litter.moist_coef,
+			patch[0].litter.density,
+			&(patch[0].litter_cs),
+			&(patch[0].litter));
+		patch[0].sat_deficit_z = compute_z_final(
+			command_line[0].verbose_flag,
+			patch[0].soil_defaults[0][0].porosity_0,
+			patch[0].soil_defaults[0][0].porosity_decay,
+			patch[0].soil_defaults[0][0].soil_depth,
+			0,
+			-1*patch[0].sat_deficit);
+	}
+	return;
+}
+
+static struct output_variable *find_sparse_variable(int level, char *name,
+													char *filename)
+{
+	struct	output_variable	*find_output_variable( int, char *);
+	struct	output_variable	*variable;
+
+	if ( ((variable = find_output_variable(level, name)) == NULL)
+		|| (variable[0].state == 0) ){
+		fprintf(stderr,
+			"FATAL ERROR: in sparse redefine file %s, %s is not a state variable and cannot be set\n",
+			filename, name);
+		exit(EXIT_FAILURE);
+	}
+	return(variable);
+}
+
+void	execute_redefine_world_sparse_event(struct world_object *world,
+									  struct command_line_object *command_line,
+									  struct date current_date)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local function definition.									*/
+	/*--------------------------------------------------------------*/
+	struct	redefine_index_object	*construct_redefine_index(
+		struct world_object *);
+	void	*alloc( size_t, char *, char * );
+
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	FILE	*sparse_file;
+	int	i, level, ID, line_number, num_fields, num_records, num_values;
+	int	num_skipped;
+	int	*field_levels;
+	char	filename[MAXSTR];
+	char	ext[MAXSTR];
+	char	magic[16];
+	char	line[MAXSTR];
+	char	field_name[SPARSE_REDEFINE_NAME_LEN];
+	char	*token, *end, *comment;
+	double	value;
+	struct	output_variable	*variable, **fields;
+	struct	sparse_redefine_record	*records;
+
+	/*--------------------------------------------------------------*/
+	/*	Try to open the redefine file in read mode.					*/
+	/*--------------------------------------------------------------*/
+	sprintf(ext,".Y%4ldM%ldD%ldH%ld",current_date.year,
+		current_date.month,
+		current_date.day,
+		current_date.hour);
+	strcpy(filename, command_line[0].world_filename);
+	strcat(filename, ext);
+	if ( (sparse_file = fopen(filename,"rb")) == NULL ){
+		fprintf(stderr,
+			"FATAL ERROR:  Cannot open sparse redefine input file %s\n",
+			filename);
+		exit(EXIT_FAILURE);
+	} /*end if*/
+	printf("\n Sparse redefine using %s", filename);
+	if (world[0].redefine_index == NULL)
+		world[0].redefine_index = construct_redefine_index(world);
+	num_values = 0;
+	num_skipped = 0;
+	/*--------------------------------------------------------------*/
+	/*	Binary form													*/
+	/*--------------------------------------------------------------*/
+	if ( (fread(magic, sizeof(magic), 1, sparse_file) == 1)
+		&& (strncmp(magic, SPARSE_REDEFINE_MAGIC, sizeof(magic)) == 0) ){
+		if ( (fread(&num_fields, sizeof(int), 1, sparse_file) != 1)
+			|| (num_fields < 0) ){
+			fprintf(stderr,"FATAL ERROR: sparse redefine file %s is truncated\n",
+				filename);
+			exit(EXIT_FAILURE);
+		}
+		fields = (struct output_variable **)
+			alloc(num_fields * sizeof(struct output_variable *),
+			"fields","execute_redefine_world_sparse_event");
+		field_levels = (int *) alloc(num_fields * sizeof(int),
+			"field_levels","execute_redefine_world_sparse_event");
+		for (i=0; i < num_fields; i++){
+			if ( (fread(&(field_levels[i]), sizeof(int), 1, sparse_file) != 1)
+				|| (fread(field_name, SPARSE_REDEFINE_NAME_LEN, 1, sparse_file) != 1) ){
+				fprintf(stderr,"FATAL ERROR: sparse redefine file %s is truncated\n",
+					filename);
+				exit(EXIT_FAILURE);
+			}
+			field_name[SPARSE_REDEFINE_NAME_LEN-1] = '\0';
+			fields[i] = find_sparse_variable(field_levels[i], field_name, filename);
+		}
+		if ( (fread(&num_records, sizeof(int), 1, sparse_file) != 1)
+			|| (num_records < 0) ){
+			fprintf(stderr,"FATAL ERROR: sparse redefine file %s is truncated\n",
+				filename);
+			exit(EXIT_FAILURE);
+		}
+		records = (struct sparse_redefine_record *)
+			alloc(num_records * sizeof(struct sparse_redefine_record),
+			"records","execute_redefine_world_sparse_event");
+		if ( (num_records > 0) && (fread(records,
+			sizeof(struct sparse_redefine_record), num_records, sparse_file)
+			!= (size_t) num_records) ){
+			fprintf(stderr,"FATAL ERROR: sparse redefine file %s is truncated\n",
+				filename);
+			exit(EXIT_FAILURE);
+		}
+		for (i=0; i < num_records; i++){
+			if ( (records[i].field < 0) || (records[i].field >= num_fields) ){
+				fprintf(stderr,"FATAL ERROR: sparse redefine file %s record %d has bad field %d\n",
+					filename, i, records[i].field);
+				exit(EXIT_FAILURE);
+			}
+			apply_sparse_value(world, command_line,
+				field_levels[records[i].field], records[i].ID,
+				fields[records[i].field], records[i].value, &num_skipped);
+		}
+		num_values = num_records;
+		free(records);
+		free(field_levels);
+		free(fields);
+	}
+	/*--------------------------------------------------------------*/
+	/*	Text form													*/
+	/*--------------------------------------------------------------*/
+	else {
+		rewind(sparse_file);
+		line_number = 0;
+		while ( fgets(line, MAXSTR, sparse_file) != NULL ){
+			line_number++;
+			if ( (comment = strchr(line, '#')) != NULL )
+				*comment = '\0';
+			if ( (token = strtok(line, " \t\r\n")) == NULL )
+				continue;
+			if ( strcmp(token, "zone") == 0 )
+				level = SCHEMA_ZONE;
+			else if ( strcmp(token, "patch") == 0 )
+				level = SCHEMA_PATCH;
+			else if ( (strcmp(token, "stratum") == 0)
+				|| (strcmp(token, "canopy_stratum") == 0) )
+				level = SCHEMA_STRATUM;
+			else {
+				fprintf(stderr,
+					"FATAL ERROR: sparse redefine file %s line %d: unknown level %s\n",
+					filename, line_number, token);
+				exit(EXIT_FAILURE);
+			}
+			token = strtok(NULL, " \t\r\n");
+			if ( (token == NULL) || ((ID = strtol(token, &end, 10)), *end != '\0') ){
+				fprintf(stderr,
+					"FATAL ERROR: sparse redefine file %s line %d: missing ID\n",
+					filename, line_number);
+				exit(EXIT_FAILURE);
+			}
+			while ( (token = strtok(NULL, " \t\r\n")) != NULL ){
+				variable = find_sparse_variable(level, token, filename);
+				token = strtok(NULL, " \t\r\n");
+				if ( (token == NULL) || ((value = strtod(token, &end)), *end != '\0') ){
+					fprintf(stderr,
+						"FATAL ERROR: sparse redefine file %s line %d: missing value for %s\n",
+						filename, line_number, variable[0].name);
+					exit(EXIT_FAILURE);
+				}
+				apply_sparse_value(world, command_line, level, ID, variable,
+					value, &num_skipped);
+				num_values++;
+			}
+		}
+	}
+	fclose(sparse_file);
+	if (num_skipped > 0)
+		printf("\n %d of %d sparse redefine values were for objects not in this world",
+			num_skipped, num_values);
+	return;
+} /*end execute_redefine_world_sparse_event*/
@@ -0,0 +1,228 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*						execute_spinup							*/
+/*																*/
+/*	execute_spinup - cycles the tec file until C and N pools	*/
+/*			reach steady state									*/
+/*																*/
+/*	NAME														*/
+/*	execute_spinup - cycles the tec file until C and N pools	*/
+/*			reach steady state									*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	void execute_spinup(										*/
+/*			struct	tec_object,									*/
+/*			struct command_line_object,					 		*/
+/*			struct	world_output_file_object,					*/
+/*			struct	world_output_file_object,					*/
+/*			struct world_object );								*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Called instead of execute_tec when -spinup is given.		*/
+/*	Each cycle runs the world from its start to its end date	*/
+/*	with execute_tec, so the climate between those dates is		*/
+/*	repeated and tec events are replayed every cycle, while		*/
+/*	the state carries over from one cycle to the next.			*/
+/*																*/
+/*	After each cycle six pools are compared per patch with		*/
+/*	their values at the start of the cycle: soil C and N		*/
+/*	(soil1-4), litter C and N (litr1-4) and plant C and N		*/
+/*	(leaf, stem, coarse and fine root and cwd pools of the		*/
+/*	strata, weighted by cover fraction).  The drift of a pool	*/
+/*	is its change over the cycle relative to its size, or the	*/
+/*	absolute change for pools smaller than SPINUP_POOL_FLOOR.	*/
+/*	A patch has converged when all six drifts are within the	*/
+/*	-spinup tolerance.											*/
+/*																*/
+/*	Without routing (-r) converged patches are frozen: zones	*/
+/*	skip them so they no longer cost simulation time.  With		*/
+/*	routing patches exchange water and all keep running, but	*/
+/*	convergence is still tracked.								*/
+/*																*/
+/*	The spin-up stops when every patch has converged or after	*/
+/*	the maximum number of cycles, and the state is then			*/
+/*	written as by output_current_state at the end date.			*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*	The window should span whole years so that the dates of		*/
+/*	consecutive cycles join up.  Output events in the tec		*/
+/*	file are repeated every cycle, so spin-up tec files			*/
+/*	normally contain none.  Frozen patches keep the moisture	*/
+/*	they had; TOPMODEL (non-routed) hillslopes still see their	*/
+/*	sat_deficit in the hillslope means.							*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "rhessys.h"
+
+#define SPINUP_NUM_POOLS	6
+#define SPINUP_POOL_FLOOR	0.001	/* kg/m2 */
+
+static void compute_spinup_pools(struct patch_object *patch, double *pools)
+{
+	int	c;
+	struct	canopy_strata_object	*stratum;
+
+	pools[0] = patch[0].soil_cs.soil1c + patch[0].soil_cs.soil2c
+		+ patch[0].soil_cs.soil3c + patch[0].soil_cs.soil4c;
+	pools[1] = patch[0].soil_ns.soil1n + patch[0].soil_ns.soil2n
+		+ patch[0].soil_ns.soil3n + patch[0].soil_ns.soil4n;
+	pools[2] = patch[0].litter_cs.litr1c + patch[0].litter_cs.litr2c
+		+ patch[0].litter_cs.litr3c + patch[0].litter_cs.litr4c;
+	pools[3] = patch[0].litter_ns.litr1n + patch[0].litter_ns.litr2n
+		+ patch[0].litter_ns.litr3n + patch[0].litter_ns.litr4n;
+	pools[4] = 0.0;
+	pools[5] = 0.0;
+	for (c=0; c < patch[0].num_canopy_strata; c++){
+		stratum = patch[0].canopy_strata[c];
+		pools[4] += stratum[0].cover_fraction * (stratum[0].cs.leafc
+			+ stratum[0].cs.dead_leafc + stratum[0].cs.live_stemc
+			+ stratum[0].cs.dead_stemc + stratum[0].cs.live_crootc
+			+ stratum[0].cs.dead_crootc + stratum[0].cs.frootc
+			+ stratum[0].cs.cwdc);
+		pools[5] += stratum[0].cover_fraction * (stratum[0].ns.leafn
+			+ stratum[0].ns.dead_leafn + stratum[0].ns.live_stemn
+			+ stratum[0].ns.dead_stemn + stratum[0].ns.live_crootn
+			+ stratum[0].ns.dead_crootn + stratum[0].ns.frootn
+			+ stratum[0].ns.cwdn);
+	}
+	return;
+}
+
+void	execute_spinup(
+					struct	tec_object *tecfile ,
+					struct command_line_object *command_line,
+					struct	world_output_file_object *outfile,
+					struct	world_output_file_object *growth_outfile,
+					struct world_object *world)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local Function Declarations.								*/
+	/*--------------------------------------------------------------*/
+	void	*alloc( size_t, char *, char * );
+	void	dealloc( void *, size_t, char *, char * );
+
+	void	execute_tec(
+		struct	tec_object *,
+		struct	command_line_object *,
+		struct	world_output_file_object *,
+		struct	world_output_file_object *,
+		struct	world_object *);
+
+	void	execute_state_output_event(
+		struct world_object *,
+		struct date,
+		struct date,
+		struct command_line_object *);
+
+	/*--------------------------------------------------------------*/
+	/*	Local Variable Definition. 									*/
+	/*--------------------------------------------------------------*/
+	int	b, h, z, p, k, i, cycle;
+	int	num_patches, num_converged, num_frozen, freeze;
+	double	drift, max_drift, patch_drift;
+	double	*pools, after[SPINUP_NUM_POOLS];
+	struct	patch_object	**patches;
+	struct	hillslope_object	*hillslope;
+	struct	zone_object	*zone;
+
+	/*--------------------------------------------------------------*/
+	/*	List the patches once										*/
+	/*--------------------------------------------------------------*/
+	num_patches = 0;
+	for (b=0; b < world[0].num_basin_files; b++)
+		for (h=0; h < world[0].basins[b][0].num_hillslopes; h++){
+			hillslope = world[0].basins[b][0].hillslopes[h];
+			for (z=0; z < hillslope[0].num_zones; z++)
+				num_patches += hillslope[0].zones[z][0].num_patches;
+		}
+	patches = (struct patch_object **)
+		alloc(num_patches * sizeof(struct patch_object *),
+		"patches","execute_spinup");
+	pools = (double *) alloc(num_patches * SPINUP_NUM_POOLS * sizeof(double),
+		"pools","execute_spinup");
+	i = 0;
+	for (b=0; b < world[0].num_basin_files; b++)
+		for (h=0; h < world[0].basins[b][0].num_hillslopes; h++){
+			hillslope = world[0].basins[b][0].hillslopes[h];
+			for (z=0; z < hillslope[0].num_zones; z++){
+				zone = hillslope[0].zones[z];
+				for (p=0; p < zone[0].num_patches; p++)
+					patches[i++] = zone[0].patches[p];
+			}
+		}
+	freeze = (command_line[0].routing_flag == 0);
+	num_frozen = 0;
+	printf("\n Spin-up of %d patches, tolerance %g, at most %d cycles%s\n",
+		num_patches, command_line[0].spinup_tol,
+		command_line[0].spinup_max_cycles,
+		freeze ? ", converged patches frozen" : "");
+
+	for (cycle=1; cycle <= command_line[0].spinup_max_cycles; cycle++){
+		for (i=0; i < num_patches; i++)
+			compute_spinup_pools(patches[i], &(pools[i*SPINUP_NUM_POOLS]));
+		/*--------------------------------------------------------------*/
+		/*	run the window again from the top of the tec file			*/
+		/*--------------------------------------------------------------*/
+		if ( fseek(tecfile[0].tfile, 0L, SEEK_SET) != 0 ){
+			fprintf(stderr,"FATAL ERROR: Unable to rewind the tec file for spin-up\n");
+			exit(EXIT_FAILURE);
+		}
+		execute_tec(tecfile, command_line, outfile, growth_outfile, world);
+		command_line[0].restart_flag = 0;
+		/*--------------------------------------------------------------*/
+		/*	drift of each patch over the cycle							*/
+		/*--------------------------------------------------------------*/
+		num_converged = 0;
+		max_drift = 0.0;
+		for (i=0; i < num_patches; i++){
+			if (patches[i][0].spinup_frozen == 1){
+				num_converged++;
+				continue;
+			}
+			compute_spinup_pools(patches[i], after);
+			patch_drift = 0.0;
+			for (k=0; k < SPINUP_NUM_POOLS; k++){
+				drift = fabs(after[k] - pools[i*SPINUP_NUM_POOLS+k])
+					/ max(fabs(pools[i*SPINUP_NUM_POOLS+k]), SPINUP_POOL_FLOOR);
+				patch_drift = max(patch_drift, drift);
+			}
+			max_drift = max(max_drift, patch_drift);
+			if (patch_drift <= command_line[0].spinup_tol){
+				num_converged++;
+				if (freeze){
+					patches[i][0].spinup_frozen = 1;
+					num_frozen++;
+				}
+			}
+		}
+		printf("\n Spin-up cycle %d: %d of %d patches converged, %d frozen, max drift %g\n",
+			cycle, num_converged, num_patches, num_frozen, max_drift);
+		fflush(stdout);
+		if (num_converged == num_patches)
+			break;
+	}
+	if (cycle > command_line[0].spinup_max_cycles)
+		printf("\n Spin-up stopped after %d cycles without full convergence\n",
+			command_line[0].spinup_max_cycles);
+	else
+		printf("\n Spin-up converged after %d cycles\n", cycle);
+	/*--------------------------------------------------------------*/
+	/*	write the spun-up state										*/
+	/*--------------------------------------------------------------*/
+	for (i=0; i < num_patches; i++)
+		patches[i][0].spinup_frozen = 0;
+	execute_state_output_event(world, world[0].end_date,
+		world[0].end_date, command_line);
+	dealloc(pools, num_patches * SPINUP_NUM_POOLS * sizeof(double),
+		"pools","execute_spinup");
+	dealloc(patches, num_patches * sizeof(struct patch_object *),
+		"patches","execute_spinup");
+	return;
+} /*end execute_spinup*/
@@ -90,6 +90,7 @@
 /*--------------------------------------------------------------*/
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include "rhessys.h"
 
 void	execute_tec(
@@ -102,6 +103,10 @@ void	execute_tec(
 	/*--------------------------------------------------------------*/
 	/*	Local Function Declarations.								*/
 	/*--------------------------------------------------------------*/
+	void	profile_start( struct profile_object *, int );
+	void	profile_stop( struct profile_object *, int );
+	void	output_telemetry( struct telemetry_object *,
+		struct profile_object *, struct date, int );
 	int		cal_date_lt(struct date, struct date );
 	
 	long	julday( struct date );
@@ -176,6 +181,31 @@ void	execute_tec(
 		struct	world_object	*,
 		struct	command_line_object	*,
 		struct	date);
+
+	void	execute_checkpoint_event(
+		struct	world_object	*,
+		struct	command_line_object	*,
+		struct	date,
+		struct	date,
+		long);
+
+	long	input_checkpoint(
+		struct	world_object	*,
+		struct	command_line_object	*,
+		struct	date	*,
+		struct	date	*);
+
+	int	execute_branch_event(
+		struct	tec_object	*,
+		struct	command_line_object	*,
+		struct	world_output_file_object	*,
+		struct	world_output_file_object	*,
+		struct	date);
+
+	void	accumulate_streamflow_objective(
+		struct	world_object	*,
+		struct	command_line_object	*,
+		struct	date);
 	
 	/*--------------------------------------------------------------*/
 	/*	Local Variable Definition. 									*/
@@ -207,11 +237,37 @@ void	execute_tec(
 	/*--------------------------------------------------------------*/
 	current_date = world[0].start_date;
 	next_date = current_date;
+	/*--------------------------------------------------------------*/
+	/*	On restart resume from the checkpoint date and tec position	*/
+	/*--------------------------------------------------------------*/
+	if (command_line[0].restart_flag == 1){
+		if ( fseek(tecfile[0].tfile, input_checkpoint(world, command_line,
+			&current_date, &next_date), SEEK_SET) != 0 ){
+			fprintf(stderr,"FATAL ERROR: Unable to resume the tec file at the checkpoint\n");
+			exit(EXIT_FAILURE);
+		}
+		day = julday(current_date) - julday(world[0].start_date);
+	}
 	while ( cal_date_lt(current_date,world[0].end_date)){
 		/*--------------------------------------------------------------*/
 		/*		Perform the tec event.									*/
 		/*--------------------------------------------------------------*/
-		handle_event(event,command_line,current_date,world);
+		/*--------------------------------------------------------------*/
+		/*		Checkpoints need the tec file position and branches	*/
+		/*		the tec and output files so are handled here rather		*/
+		/*		than in handle_event.  The parent of a branch stops		*/
+		/*		once its scenarios are done.							*/
+		/*--------------------------------------------------------------*/
+		if ( !strcmp(event[0].command,"output_checkpoint") )
+			execute_checkpoint_event(world, command_line, current_date,
+				next_date, ftell(tecfile[0].tfile));
+		else if ( !strcmp(event[0].command,"branch") ){
+			if ( execute_branch_event(tecfile, command_line, outfile,
+				growth_outfile, current_date) == 0 )
+				return;
+		}
+		else
+			handle_event(event,command_line,current_date,world);
 		/*--------------------------------------------------------------*/
 		/*		read the next tec file entry.							*/
 		/*		if we are not at the end of the tec file.				*/
@@ -257,26 +313,33 @@ void	execute_tec(
 			/*			Simulate the world for the start of this day e		*/
 			/*--------------------------------------------------------------*/
 			if ( current_date.hour == 1 ){
+				profile_start(command_line[0].profile, PROFILE_WORLD_DAILY_I);
 				world_daily_I(
 					day,
 					world,
 					command_line,
 					event,
 					current_date);
+				profile_stop(command_line[0].profile, PROFILE_WORLD_DAILY_I);
 			} /*end if*/
 			/*--------------------------------------------------------------*/
 			/*          Do hourly stuff for the day.                        */
 			/*--------------------------------------------------------------*/
+			profile_start(command_line[0].profile, PROFILE_WORLD_HOURLY);
 			world_hourly( world,
 				command_line,
 				event,
 				current_date);
+			profile_stop(command_line[0].profile, PROFILE_WORLD_HOURLY);
 			
 			/*--------------------------------------------------------------*/
 			/*			Perform any requested hourly output					*/
 			/*--------------------------------------------------------------*/
-			if (command_line[0].output_flags.hourly == 1)
+			if (command_line[0].output_flags.hourly == 1){
+				profile_start(command_line[0].profile, PROFILE_HOURLY_OUTPUT);
 				execute_hourly_output_event(world,command_line,current_date,outfile);
+				profile_stop(command_line[0].profile, PROFILE_HOURLY_OUTPUT);
+			}
 			/*--------------------------------------------------------------*/
 			/*			Increment to the next hour.							*/
 			/*--------------------------------------------------------------*/
@@ -288,53 +351,77 @@ void	execute_tec(
 				/*--------------------------------------------------------------*/
 				/*			Simulate the world for the end of this day e		*/
 				/*--------------------------------------------------------------*/
+				profile_start(command_line[0].profile, PROFILE_WORLD_DAILY_F);
 				world_daily_F(
 					day,
 					world,
 					command_line,
 					event,
 					current_date);
+				profile_stop(command_line[0].profile, PROFILE_WORLD_DAILY_F);
 			        // printf("%s\n","finish_daily_simulation");	
 				/*--------------------------------------------------------------*/
+				/*			Score the day against observed streamflow (-obs)	*/
+				/*--------------------------------------------------------------*/
+				if (command_line[0].obs_flag == 1)
+					accumulate_streamflow_objective(world, command_line, current_date);
+				/*--------------------------------------------------------------*/
 				/*			Perform any requested daily output					*/
 				/*--------------------------------------------------------------*/
 				if ((command_line[0].output_flags.daily_growth == 1) &&
 							(command_line[0].grow_flag > 0) ) {
+						profile_start(command_line[0].profile, PROFILE_DAILY_GROWTH_OUTPUT);
 						execute_daily_growth_output_event(
 						world,
 						command_line,
 						current_date,
 						growth_outfile);
+						profile_stop(command_line[0].profile, PROFILE_DAILY_GROWTH_OUTPUT);
 				}
-				if (command_line[0].output_flags.daily == 1) {
+				if ((command_line[0].output_flags.daily == 1)
+					&& (command_line[0].obs_flag == 0)) {
                                                 //printf("%s\n","before_daily_output");
+						profile_start(command_line[0].profile, PROFILE_DAILY_OUTPUT);
 						execute_daily_output_event(
 						world,
 						command_line,
 						current_date,
 						outfile);
+						profile_stop(command_line[0].profile, PROFILE_DAILY_OUTPUT);
                                }
 				/*--------------------------------------------------------------*/
 				/*			Perform any requested yearly output					*/
 				/*--------------------------------------------------------------*/
 				if ((command_line[0].output_flags.yearly == 1) &&
 					(command_line[0].output_yearly_date.month==current_date.month)&&
-					(command_line[0].output_yearly_date.day == current_date.day))
+					(command_line[0].output_yearly_date.day == current_date.day)){
+							profile_start(command_line[0].profile, PROFILE_YEARLY_OUTPUT);
 							execute_yearly_output_event(
 							world,
 							command_line,
 							current_date,
 							outfile);
+							profile_stop(command_line[0].profile, PROFILE_YEARLY_OUTPUT);
+				}
 
 				if ((command_line[0].output_flags.yearly_growth == 1) &&
 					(command_line[0].output_yearly_date.month==current_date.month)&&
 					(command_line[0].output_yearly_date.day == current_date.day) &&
-					(command_line[0].grow_flag > 0) )
+					(command_line[0].grow_flag > 0) ){
+					profile_start(command_line[0].profile, PROFILE_YEARLY_GROWTH_OUTPUT);
 					execute_yearly_growth_output_event(
 					world,
 					command_line,
 					current_date,
 					growth_outfile);
+					profile_stop(command_line[0].profile, PROFILE_YEARLY_GROWTH_OUTPUT);
+				}
+				/*--------------------------------------------------------------*/
+				/*			Report progress (-telemetry)						*/
+				/*--------------------------------------------------------------*/
+				if (command_line[0].telemetry != NULL)
+					output_telemetry(command_line[0].telemetry,
+						command_line[0].profile, current_date, 0);
 				/*--------------------------------------------------------------*/
 				/*				Determine the new calendar date if we add 1 day.*/
 				/*				Do this by first conversting the current cal	*/
@@ -372,12 +459,15 @@ void	execute_tec(
 				/*--------------------------------------------------------------*/
 				/*			Perform any requested monthly output				*/
 				/*--------------------------------------------------------------*/
-				if (command_line[0].output_flags.monthly == 1)
+				if (command_line[0].output_flags.monthly == 1){
+						profile_start(command_line[0].profile, PROFILE_MONTHLY_OUTPUT);
 						execute_monthly_output_event(
 						world,
 						command_line,
 						current_date,
 						outfile);
+						profile_stop(command_line[0].profile, PROFILE_MONTHLY_OUTPUT);
+				}
 				/*--------------------------------------------------------------*/
 				/*				increment month 								*/
 				/*--------------------------------------------------------------*/
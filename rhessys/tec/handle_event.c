@@ -37,6 +37,9 @@
 /*	Sept, 98 - C.Tague	*/
 /*	added comma delimited output event */
 /*																*/
+/*	output_memory_report prints the alloc tallies (see		*/
+/*	util/alloc.c) and the resident set size to stdout.		*/
+/*																*/
 /*--------------------------------------------------------------*/
 #include <stdio.h>
 #include <stdlib.h>
@@ -52,6 +55,7 @@ void	handle_event(
 	/*--------------------------------------------------------------*/
 	/*	Local Function Declarations.								*/
 	/*--------------------------------------------------------------*/
+	void	alloc_report( FILE * );
 	void	execute_redefine_strata_event(
 		struct world_object *,
 		struct command_line_object *,
@@ -69,6 +73,10 @@ void	handle_event(
 		struct command_line_object *,
 		struct	date,
 		int);
+	void	execute_redefine_world_sparse_event(
+		struct world_object *,
+		struct command_line_object *,
+		struct	date);
 	void	execute_road_construction_event(
 		struct world_object *,
 		struct command_line_object *,
@@ -174,6 +182,9 @@ void	handle_event(
 	else if ( !strcmp(event[0].command,"redefine_world_thin_harvest") ){
 		execute_redefine_world_thin_event(world, command_line, current_date, 2);
 	}		
+	else if ( !strcmp(event[0].command,"redefine_world_sparse") ){
+		execute_redefine_world_sparse_event(world, command_line, current_date);
+	}
 	else if ( !strcmp(event[0].command,"roads_on") ){
 		command_line[0].road_flag = 1;
 		execute_road_construction_event(world, command_line, current_date);
@@ -181,6 +192,12 @@ void	handle_event(
 	else if ( !strcmp(event[0].command,"roads_off") ){
 		command_line[0].road_flag = 0;
 	}
+	else if ( !strcmp(event[0].command,"output_memory_report") ){
+		printf("\n Memory report for %ld %ld %ld %ld",
+			current_date.year, current_date.month,
+			current_date.day, current_date.hour);
+		alloc_report(stdout);
+	}
 	else{
 		fprintf(stderr,"FATAL ERROR: in handle event - event %s not recognized.\n",
 			event[0].command);
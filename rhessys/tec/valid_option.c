@@ -74,6 +74,21 @@ int	 valid_option( char *command_line){
 		(strcmp(command_line,"-surfaceenergy") == 0) ||
 		(strcmp(command_line,"-firespread") == 0) ||
 		(strcmp(command_line,"-snowdistb") == 0) ||
+		(strcmp(command_line,"-outschema") == 0) ||
+		(strcmp(command_line,"-ocomp") == 0) ||
+		(strcmp(command_line,"-restart") == 0) ||
+		(strcmp(command_line,"-ensemble") == 0) ||
+		(strcmp(command_line,"-spinup") == 0) ||
+		(strcmp(command_line,"-obs") == 0) ||
+		(strcmp(command_line,"-branch") == 0) ||
+		(strcmp(command_line,"-outlet") == 0) ||
+		(strcmp(command_line,"-seed") == 0) ||
+		(strcmp(command_line,"-profile") == 0) ||
+		(strcmp(command_line,"-memreport") == 0) ||
+		(strcmp(command_line,"-telemetry") == 0) ||
+		(strcmp(command_line,"-soiltable") == 0) ||
+		(strcmp(command_line,"-adaptroute") == 0) ||
+		(strcmp(command_line,"-routing_active_tol") == 0) ||
 		(strcmp(command_line,"-template") == 0))
 		i = 0;
 	if ( i == 0 ){
@@ -0,0 +1,201 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					compare_output								*/
+/*																*/
+/*	compare_output - compares a rhessys output file with a		*/
+/*			golden copy within tolerances						*/
+/*																*/
+/*	NAME														*/
+/*	compare_output - compares a rhessys output file with a		*/
+/*			golden copy within tolerances						*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	compare_output [-a abs_tol] [-r rel_tol] golden output		*/
+/*																*/
+/*	OPTIONS														*/
+/*	-a	absolute tolerance (default 0)							*/
+/*	-r	relative tolerance (default 0)							*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Reads both files as whitespace separated tables with a		*/
+/*	header line (basin, patch and stratum .daily, .monthly		*/
+/*	and .yearly output).  The headers and the number of lines	*/
+/*	and fields must match.  Fields that are numbers in both		*/
+/*	files match if												*/
+/*																*/
+/*		|output - golden| <= abs_tol + rel_tol * |golden|		*/
+/*																*/
+/*	and any other field must be the same text.  Prints one		*/
+/*	line:														*/
+/*																*/
+/*		status max_abs max_rel num_bad							*/
+/*																*/
+/*	with status pass or fail, the largest absolute and			*/
+/*	relative differences and the number of fields out of		*/
+/*	tolerance, followed on failure by the first field out of	*/
+/*	tolerance (line and column name).  Exits 0 on pass, 1 on	*/
+/*	fail and 2 if a file cannot be read or the tables do not	*/
+/*	have the same shape.										*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*	The relative difference is taken against |golden| and is	*/
+/*	not counted where golden is 0.  NaN matches only NaN.		*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define MAXLINE	65536
+#define MAXFIELDS	1024
+
+static	int	split_fields(char *line, char **fields)
+{
+	int	n;
+	char	*token;
+
+	n = 0;
+	token = strtok(line, " \t\r\n");
+	while ( (token != NULL) && (n < MAXFIELDS) ){
+		fields[n++] = token;
+		token = strtok(NULL, " \t\r\n");
+	}
+	return(n);
+}
+
+static	int	read_number(char *field, double *value)
+{
+	char	*end;
+
+	*value = strtod(field, &end);
+	return( (end != field) && (*end == '\0') );
+}
+
+static	FILE	*open_table(char *filename)
+{
+	FILE	*table;
+
+	if ( (table = fopen(filename, "r")) == NULL ){
+		fprintf(stderr, "FATAL ERROR: cannot open %s\n", filename);
+		exit(2);
+	}
+	return(table);
+}
+
+int	main(int argc, char **argv)
+{
+	/*--------------------------------------------------------------*/
+	/*	Local variable definition.									*/
+	/*--------------------------------------------------------------*/
+	int	i, f, num_golden, num_output, num_header, line;
+	long	num_bad;
+	double	abs_tol, rel_tol, golden_value, output_value;
+	double	abs_diff, rel_diff, max_abs, max_rel;
+	char	*golden_line, *output_line, *header_line;
+	char	*golden_fields[MAXFIELDS], *output_fields[MAXFIELDS];
+	char	*header[MAXFIELDS];
+	char	first_bad[MAXLINE];
+	FILE	*golden, *output;
+
+	abs_tol = 0.0;
+	rel_tol = 0.0;
+	for (i=1; (i < argc - 2) && (argv[i][0] == '-'); i += 2){
+		if (strcmp(argv[i], "-a") == 0)
+			abs_tol = atof(argv[i+1]);
+		else if (strcmp(argv[i], "-r") == 0)
+			rel_tol = atof(argv[i+1]);
+		else
+			break;
+	}
+	if (i != argc - 2){
+		fprintf(stderr,
+			"usage: compare_output [-a abs_tol] [-r rel_tol] golden output\n");
+		exit(2);
+	}
+	golden = open_table(argv[i]);
+	output = open_table(argv[i+1]);
+	golden_line = (char *) malloc(MAXLINE);
+	output_line = (char *) malloc(MAXLINE);
+	header_line = (char *) malloc(MAXLINE);
+	if ( (golden_line == NULL) || (output_line == NULL)
+		|| (header_line == NULL) ){
+		fprintf(stderr, "FATAL ERROR: out of memory\n");
+		exit(2);
+	}
+	/*--------------------------------------------------------------*/
+	/*	headers														*/
+	/*--------------------------------------------------------------*/
+	if ( (fgets(header_line, MAXLINE, golden) == NULL)
+		|| (fgets(output_line, MAXLINE, output) == NULL) ){
+		fprintf(stderr, "FATAL ERROR: empty file\n");
+		exit(2);
+	}
+	if (strcmp(header_line, output_line) != 0){
+		fprintf(stderr, "FATAL ERROR: headers differ\n");
+		exit(2);
+	}
+	num_header = split_fields(header_line, header);
+	/*--------------------------------------------------------------*/
+	/*	values														*/
+	/*--------------------------------------------------------------*/
+	max_abs = 0.0;
+	max_rel = 0.0;
+	num_bad = 0;
+	first_bad[0] = '\0';
+	line = 1;
+	while (fgets(golden_line, MAXLINE, golden) != NULL){
+		line++;
+		if (fgets(output_line, MAXLINE, output) == NULL){
+			fprintf(stderr, "FATAL ERROR: output ends at line %d\n", line);
+			exit(2);
+		}
+		num_golden = split_fields(golden_line, golden_fields);
+		num_output = split_fields(output_line, output_fields);
+		if (num_golden != num_output){
+			fprintf(stderr, "FATAL ERROR: line %d has %d fields, golden %d\n",
+				line, num_output, num_golden);
+			exit(2);
+		}
+		for (f=0; f < num_golden; f++){
+			if ( read_number(golden_fields[f], &golden_value)
+				&& read_number(output_fields[f], &output_value) ){
+				if (isnan(golden_value) || isnan(output_value)){
+					if (isnan(golden_value) && isnan(output_value))
+						continue;
+				}
+				else {
+					abs_diff = fabs(output_value - golden_value);
+					rel_diff = (golden_value != 0.0) ?
+						abs_diff / fabs(golden_value) : 0.0;
+					if (abs_diff > max_abs)
+						max_abs = abs_diff;
+					if (rel_diff > max_rel)
+						max_rel = rel_diff;
+					if (abs_diff <= abs_tol + rel_tol * fabs(golden_value))
+						continue;
+				}
+			}
+			else if (strcmp(golden_fields[f], output_fields[f]) == 0)
+				continue;
+			if (num_bad == 0)
+				snprintf(first_bad, MAXLINE, "line %d %s: golden %s output %s",
+					line, (f < num_header) ? header[f] : "?",
+					golden_fields[f], output_fields[f]);
+			num_bad++;
+		}
+	}
+	if (fgets(output_line, MAXLINE, output) != NULL){
+		fprintf(stderr, "FATAL ERROR: output is longer than golden\n");
+		exit(2);
+	}
+	fclose(golden);
+	fclose(output);
+	printf("%s %g %g %ld\n", (num_bad == 0) ? "pass" : "fail",
+		max_abs, max_rel, num_bad);
+	if (num_bad > 0)
+		printf("%s\n", first_bad);
+	return( (num_bad == 0) ? 0 : 1 );
+}
@@ -0,0 +1,165 @@
+#!/bin/bash
+# This shell script runs rhessys on the bundled test world and compares
+# basin, patch, stratum and (with -g) growth daily output with the golden
+# files, then checks which sparse redefine files are accepted
+
+rhessys=`dirname $0`/../rhessys5.18.r2
+abs_tol=1e-9
+rel_tol=1e-6
+options=
+build=default
+golden_flag=0
+
+USAGE="Usage: `basename $0` [-b rhessys] [-a abs_tol] [-r rel_tol] [-o \"rhessys options\"] [-l build] [-g]"
+
+# Parse command line options.
+while getopts b:a:r:o:l:gh OPT; do
+    case "$OPT" in
+        b)
+            rhessys=$OPTARG
+            ;;
+        a)
+            abs_tol=$OPTARG
+            ;;
+        r)
+            rel_tol=$OPTARG
+            ;;
+        o)
+            options=$OPTARG
+            ;;
+        l)
+            build=$OPTARG
+            ;;
+        g)
+            golden_flag=1
+            ;;
+        h)
+            echo $USAGE
+            exit 0
+            ;;
+        \?)
+            # getopts issues an error message
+            echo $USAGE >&2
+            exit 1
+            ;;
+    esac
+done
+
+if [ ! -x "$rhessys" ]; then
+    echo "`basename $0`: $rhessys not found, build rhessys first" >&2
+    exit 1
+fi
+rhessys=`cd \`dirname $rhessys\` && pwd`/`basename $rhessys`
+cd `dirname $0`
+testdir=`pwd`
+compare=$testdir/compare_output
+outdir=$testdir/output
+rm -rf $outdir
+mkdir -p $outdir $testdir/golden
+
+# name|world|tec|rhessys options; world selects worlds/<world>.world.hdr
+# for worlds/synth.world and tec tecfiles/<tec>.tec.  Every configuration
+# writes basin, patch and stratum daily output for 2000; the growth tec
+# file also turns on print_daily_growth_on for the grow_ files.
+# synth has little runoff and constant porosity; wet has exponential
+# porosity and three times the rain, so it produces streamflow and
+# return flow.
+configs="
+topmodel|synth|synth|
+routing|synth|synth|-r flows/synth.flow
+routing_gw|synth|synth|-r flows/synth.flow -gw 0.1 0.1
+routing_growth|synth|growth|-r flows/synth.flow -g
+routing_wet|wet|growth|-r flows/synth.flow -g -gw 0.1 0.1
+"
+daily_files="basin.daily patch.daily stratum.daily"
+grow_files="grow_basin.daily grow_patch.daily grow_stratum.daily"
+
+header="date,config,options,file,status,max_abs,max_rel,num_bad,seconds,build"
+if [ -f results.csv ] && [ "`head -1 results.csv`" != "$header" ]; then
+    mv results.csv results.csv.old
+fi
+if [ ! -f results.csv ]; then
+    echo "$header" > results.csv
+fi
+
+failed=0
+echo "build $build"
+printf "%-16s %-18s %-6s %12s %12s %8s %8s\n" config file status max_abs max_rel bad seconds
+while IFS='|' read name world tec config_options; do
+    [ -z "$name" ] && continue
+    start=`date +%s.%N`
+    (cd world && $rhessys -t tecfiles/$tec.tec -w worlds/synth.world \
+        -whdr worlds/$world.world.hdr -st 2000 1 1 1 -ed 2001 1 1 1 \
+        -b -p -c $config_options $options -pre $outdir/$name > $outdir/$name.log 2>&1)
+    status=$?
+    end=`date +%s.%N`
+    seconds=`awk -v s=$start -v e=$end 'BEGIN { printf "%.3f", e - s }'`
+    if [ $status -ne 0 ]; then
+        echo "$name: rhessys failed, see $outdir/$name.log" >&2
+        failed=1
+        continue
+    fi
+    files=$daily_files
+    if [ -f $outdir/${name}_grow_basin.daily ]; then
+        files="$files $grow_files"
+    fi
+    for file in $files; do
+        if [ $golden_flag -eq 1 ]; then
+            gzip -9n -c $outdir/${name}_$file > golden/${name}_$file.gz
+            printf "%-16s %-18s %-6s %12s %12s %8s %8s\n" $name $file golden "" "" "" $seconds
+            continue
+        fi
+        gzip -dc golden/${name}_$file.gz > $outdir/${name}_$file.golden
+        result=`$compare -a $abs_tol -r $rel_tol $outdir/${name}_$file.golden $outdir/${name}_$file 2>&1`
+        if [ $? -ne 0 ]; then
+            failed=1
+        fi
+        set -- $result
+        if [ "$1" != pass -a "$1" != fail ]; then
+            set -- error "" "" "" "$result"
+        fi
+        printf "%-16s %-18s %-6s %12s %12s %8s %8s\n" $name $file "$1" "$2" "$3" "$4" $seconds
+        echo "`date +%Y-%m-%d`,$name,$options,$file,$1,$2,$3,$4,$seconds,$build" >> results.csv
+        if [ "$1" != pass ]; then
+            shift 4
+            echo "    $*"
+        fi
+    done
+done <<< "$configs"
+
+# name|tec|expected; each tec file runs one redefine_world_sparse event on
+# the file worlds/synth.world.Y2000M1D<day>H1 for its day.  expected is
+# "ok", or text that must appear in the FATAL ERROR of a rejected file.
+checks="
+sparse_state|sparse_state|ok
+sparse_area|sparse_area|area is not a state variable
+sparse_slope|sparse_slope|slope is not a state variable
+"
+while IFS='|' read name tec expected; do
+    [ -z "$name" ] && continue
+    (cd world && $rhessys -t tecfiles/$tec.tec -w worlds/synth.world \
+        -whdr worlds/synth.world.hdr -st 2000 1 1 1 -ed 2000 1 5 1 \
+        -b -r flows/synth.flow -pre $outdir/$name > $outdir/$name.log 2>&1)
+    status=$?
+    if [ "$expected" = ok ]; then
+        [ $status -eq 0 ]
+    else
+        [ $status -ne 0 ] && grep -q "$expected" $outdir/$name.log
+    fi
+    if [ $? -eq 0 ]; then
+        result=pass
+    else
+        result=fail
+        failed=1
+    fi
+    printf "%-16s %-18s %s\n" $name log $result
+    if [ $result != pass ]; then
+        echo "    expected $expected, see $outdir/$name.log"
+    fi
+done <<< "$checks"
+
+if [ $failed -ne 0 ]; then
+    echo "`basename $0`: FAILED" >&2
+    exit 1
+fi
+exit 0
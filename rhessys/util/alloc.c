@@ -9,6 +9,9 @@
 /*																*/
 /*	SYNOPSIS													*/
 /*	void	*alloc( size_t, char*, char* )						*/
+/*	void	dealloc( void *, size_t, char*, char* )				*/
+/*	void	alloc_accounting( int )								*/
+/*	void	alloc_report( FILE * )								*/
 /*																*/
 /*	OPTIONS														*/
 /*	size_t	size	- size of array in bytes					*/
@@ -23,13 +26,89 @@
 /*	is used.  If malloc returns a NULL pointer a fatal			*/
 /* 	error results.												*/
 /*																*/
+/*	Once alloc_accounting(1) is called (-memreport) every		*/
+/*	allocation is tallied under its array name and calling		*/
+/*	function: number of allocations, bytes held and the most	*/
+/*	bytes held at once.  dealloc frees an array and takes it	*/
+/*	off its tally; it must be given the size and names the		*/
+/*	array was allocated with.  alloc_report prints the tallies,	*/
+/*	largest first, with the total held, its peak and the		*/
+/*	current and peak resident set size of the process.			*/
+/*																*/
 /*	PROGRAMMER NOTES											*/
 /*	The routine performs as follows:							*/
+/*																*/
+/*	Only arrays released with dealloc come off the tallies;		*/
+/*	those released with free (mostly by the destroy routines	*/
+/*	at the end of the run) are counted as held, so the report	*/
+/*	is only exact before those run.  Tags beyond				*/
+/*	ALLOC_MAX_TAGS are tallied together as "(other)".			*/
 /*--------------------------------------------------------------*/
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 
+#define ALLOC_MAX_TAGS	4096
+#define ALLOC_TAG_LEN	80
+
+struct	alloc_tag
+	{
+	char	name[ALLOC_TAG_LEN];
+	long	count;
+	long	held;
+	size_t	bytes;
+	size_t	peak_bytes;
+	};
+
+static	int	alloc_accounting_flag = 0;
+static	int	alloc_num_tags = 0;
+static	size_t	alloc_bytes = 0;
+static	size_t	alloc_peak_bytes = 0;
+static	struct	alloc_tag	*alloc_tags = NULL;
+
+static	struct alloc_tag *find_alloc_tag(char *array_name,
+										 char *calling_function)
+{
+	unsigned long	hash;
+	int	i;
+	char	name[ALLOC_TAG_LEN];
+
+	snprintf(name, ALLOC_TAG_LEN, "%s (%s)", array_name, calling_function);
+	hash = 5381;
+	for (i=0; name[i] != '\0'; i++)
+		hash = hash * 33 + (unsigned char) name[i];
+	/*--------------------------------------------------------------*/
+	/*	open addressing; the last slot is kept for (other)			*/
+	/*--------------------------------------------------------------*/
+	i = (int) (hash % (ALLOC_MAX_TAGS - 1));
+	while (alloc_tags[i].name[0] != '\0'){
+		if (strcmp(alloc_tags[i].name, name) == 0)
+			return(&(alloc_tags[i]));
+		i = (i + 1) % (ALLOC_MAX_TAGS - 1);
+		if (i == (int) (hash % (ALLOC_MAX_TAGS - 1)))
+			return(&(alloc_tags[ALLOC_MAX_TAGS - 1]));
+	}
+	strcpy(alloc_tags[i].name, name);
+	alloc_num_tags++;
+	return(&(alloc_tags[i]));
+}
+
+void	alloc_accounting(int on)
+{
+	if ( (on == 1) && (alloc_tags == NULL) ){
+		alloc_tags = (struct alloc_tag *) calloc(ALLOC_MAX_TAGS,
+			sizeof(struct alloc_tag));
+		if (alloc_tags == NULL){
+			fprintf(stderr,
+				"FATAL ERROR: in alloc_accounting, unable to allocate tags\n");
+			exit(EXIT_FAILURE);
+		}
+		strcpy(alloc_tags[ALLOC_MAX_TAGS - 1].name, "(other)");
+	}
+	alloc_accounting_flag = on;
+	return;
+}
+
 void	*alloc(size_t size, char *array_name, char *calling_function)
 {
 	/*------------------------------------------------------*/
@@ -40,6 +119,7 @@ void	*alloc(size_t size, char *array_name, char *calling_function)
 	/*	Local Variable Definition. 							*/
 	/*------------------------------------------------------*/
 	void	*array;
+	struct	alloc_tag	*tag;
 	
 	/*-------------------------------------------------*/
 	/*	Check if the requested array is of size 0 		*/
@@ -73,9 +153,102 @@ void	*alloc(size_t size, char *array_name, char *calling_function)
 			/*--------------------------------------------------------------*/
 			memset(array, 0, size);
 			/*--------------------------------------------------------------*/
+			/*		Tally it (-memreport).									*/
+			/*--------------------------------------------------------------*/
+			if (alloc_accounting_flag == 1){
+				tag = find_alloc_tag(array_name, calling_function);
+				tag[0].count++;
+				tag[0].held++;
+				tag[0].bytes += size;
+				if (tag[0].bytes > tag[0].peak_bytes)
+					tag[0].peak_bytes = tag[0].bytes;
+				alloc_bytes += size;
+				if (alloc_bytes > alloc_peak_bytes)
+					alloc_peak_bytes = alloc_bytes;
+			}
+			/*--------------------------------------------------------------*/
 			/*			Return pointer to allocated array.	*/
 			/*--------------------------------------------------------------*/
 			return(array);
 		}
 	}
 } /*end alloc.c*/
+
+void	dealloc(void *array, size_t size, char *array_name,
+				char *calling_function)
+{
+	struct	alloc_tag	*tag;
+
+	if (array == NULL)
+		return;
+	free(array);
+	if (alloc_accounting_flag == 1){
+		tag = find_alloc_tag(array_name, calling_function);
+		if ( (tag[0].held > 0) && (tag[0].bytes >= size) ){
+			tag[0].held--;
+			tag[0].bytes -= size;
+			alloc_bytes -= size;
+		}
+	}
+	return;
+} /*end dealloc*/
+
+static	int	compare_alloc_tags(const void *a, const void *b)
+{
+	const struct alloc_tag *ta = a, *tb = b;
+
+	if (ta[0].bytes != tb[0].bytes)
+		return( (ta[0].bytes < tb[0].bytes) ? 1 : -1 );
+	return( strcmp(ta[0].name, tb[0].name) );
+}
+
+void	alloc_report(FILE *out)
+{
+	void	resident_set_size( double *, double * );
+	int	i, n;
+	double	current, peak;
+	struct	alloc_tag	*sorted;
+
+	fprintf(out, "\n Memory (alloc)\n");
+	if (alloc_tags == NULL)
+		fprintf(out, " allocations not tallied (needs -memreport)\n");
+	else {
+		/*--------------------------------------------------------------*/
+		/*	largest first												*/
+		/*--------------------------------------------------------------*/
+		sorted = (struct alloc_tag *) calloc(ALLOC_MAX_TAGS,
+			sizeof(struct alloc_tag));
+		if (sorted == NULL){
+			fprintf(stderr,
+				"FATAL ERROR: in alloc_report, unable to allocate tags\n");
+			exit(EXIT_FAILURE);
+		}
+		n = 0;
+		for (i=0; i < ALLOC_MAX_TAGS; i++)
+			if (alloc_tags[i].count > 0)
+				sorted[n++] = alloc_tags[i];
+		qsort(sorted, n, sizeof(struct alloc_tag), compare_alloc_tags);
+		fprintf(out, " %-60s %10s %10s %14s %14s %6s\n", "array (function)",
+			"allocs", "held", "bytes", "peak_bytes", "%");
+		for (i=0; i < n; i++)
+			fprintf(out, " %-60s %10ld %10ld %14lu %14lu %5.1f%%\n",
+				sorted[i].name, sorted[i].count, sorted[i].held,
+				(unsigned long) sorted[i].bytes,
+				(unsigned long) sorted[i].peak_bytes,
+				(alloc_bytes > 0) ?
+				100.0 * (double) sorted[i].bytes / (double) alloc_bytes : 0.0);
+		fprintf(out, " %-60s %10s %10s %14lu %14lu\n", "total", "", "",
+			(unsigned long) alloc_bytes, (unsigned long) alloc_peak_bytes);
+		free(sorted);
+	}
+	/*--------------------------------------------------------------*/
+	/*	resident set size, which includes memory not from alloc		*/
+	/*--------------------------------------------------------------*/
+	resident_set_size(&current, &peak);
+	if (current >= 0.0)
+		fprintf(out, " resident set size %.1f MB\n", current);
+	if (peak >= 0.0)
+		fprintf(out, " peak resident set size %.1f MB\n", peak);
+	fflush(out);
+	return;
+} /*end alloc_report*/
@@ -0,0 +1,82 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					compute_basin_streamflow					*/
+/*																*/
+/*	compute_basin_streamflow - daily streamflow at the basin	*/
+/*			outlet												*/
+/*																*/
+/*	NAME														*/
+/*	compute_basin_streamflow - daily streamflow at the basin	*/
+/*			outlet												*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	double compute_basin_streamflow(							*/
+/*					struct	command_line_object	*command_line,	*/
+/*					struct	basin_object	*basin)				*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Returns the basin streamflow in m/day, the value			*/
+/*	output_basin writes (in mm) in the streamflow column: with	*/
+/*	routing the area weighted streamflow of stream patches,		*/
+/*	otherwise the return flow; plus hillslope baseflow.  With	*/
+/*	stream routing (-str) the outlet reach flow is returned		*/
+/*	instead, as in the last column of the basin output.			*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*	The sums are taken in the same order as output_basin so	*/
+/*	the result matches the daily output to the last digit.		*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include "rhessys.h"
+
+double	compute_basin_streamflow(
+								 struct	command_line_object	*command_line,
+								 struct	basin_object	*basin)
+{
+	/*------------------------------------------------------*/
+	/*	Local Variable Definition. 							*/
+	/*------------------------------------------------------*/
+	int	h, z, p;
+	double	astreamflow, areturn_flow, aarea;
+	double	hbase_flow, hill_area, basin_area;
+	struct	hillslope_object	*hillslope;
+	struct	zone_object	*zone;
+	struct	patch_object	*patch;
+
+	astreamflow = 0.0;
+	areturn_flow = 0.0;
+	aarea = 0.0;
+	hbase_flow = 0.0;
+	basin_area = 0.0;
+	for (h=0; h < basin[0].num_hillslopes; h++){
+		hillslope = basin[0].hillslopes[h];
+		hill_area = 0.0;
+		for (z=0; z < hillslope[0].num_zones; z++){
+			zone = hillslope[0].zones[z];
+			for (p=0; p < zone[0].num_patches; p++){
+				patch = zone[0].patches[p];
+				if ((command_line[0].routing_flag == 1)
+					&& (patch[0].drainage_type == STREAM))
+					astreamflow += patch[0].streamflow * patch[0].area;
+				areturn_flow += patch[0].return_flow * patch[0].area;
+				aarea += patch[0].area;
+				hill_area += patch[0].area;
+			}
+		}
+		hbase_flow += hillslope[0].base_flow * hill_area;
+		basin_area += hill_area;
+	}
+	if (command_line[0].stream_routing_flag == 1)
+		return(basin[0].stream_list.streamflow * 24 * 3600 / aarea);
+	areturn_flow /= aarea;
+	astreamflow /= aarea;
+	astreamflow += (hbase_flow / basin_area);
+	if (command_line[0].routing_flag == 0)
+		astreamflow += areturn_flow;
+	return(astreamflow);
+} /*end compute_basin_streamflow*/
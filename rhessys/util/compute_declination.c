@@ -0,0 +1,52 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					compute_declination							*/
+/*																*/
+/*	NAME														*/
+/*	compute_declination - solar declination of a declination	*/
+/*			index												*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	double	compute_declination( int index )					*/
+/*																*/
+/*	OPTIONS														*/
+/*	index - 0 to NUM_DECLINATIONS-1; the day of year		*/
+/*		year_day falls in index (int)(1 + year_day/8)			*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Returns the declination (rads) from the look up table of	*/
+/*	the C version of rhessys, an approximation of				*/
+/*																*/
+/*      declination = 23.45 sin(0.986 Nm) degrees               */
+/*																*/
+/*	where Nm = number of days since March 21 (Linacre, Climate	*/
+/*	Data and Resources, p. 148).								*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*	Shared by world_daily_I and construct_solar_ephemeris so	*/
+/*	the basin tables are built from the same declinations.		*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include "rhessys.h"
+
+double	compute_declination( int index )
+{
+	static double	declination_array[NUM_DECLINATIONS] = { 0.0, -23.0, -22.0, -21.0, -19.0,
+		-17.0, -15.0, -12.0, -9.0, -6.0, -3.0, 0.0, 3.0,
+		6.0, 9.0, 12.0, 14.0, 17.0, 19.0, 21.0, 22.0,
+		23.0, 23.5, 23.5, 23.0, 21.5, 20.0, 18.0, 16.0, 14.0,
+		12.0, 9.0, 6.0, 3.0, 0.0, -3.0, -6.0, -9.0, -12.0,
+		-15.0, -17.0, -19.0, -21.0, -22.0, -23.0, -23.5,
+		-23.5 };
+
+	if ( (index < 0) || (index >= NUM_DECLINATIONS) ){
+		fprintf(stderr,"FATAL ERROR: in compute_declination index %d out of range\n",
+			index);
+		exit(EXIT_FAILURE);
+	}
+	return( declination_array[index]*DtoR );
+} /*end compute_declination*/
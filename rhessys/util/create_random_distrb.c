@@ -1,5 +1,5 @@
 /*--------------------------------------------------------------*/
-/*                                                              */ 
+/*                                                              */
 /*		create_random_distrb					*/
 /*                                                              */
 /*  NAME                                                        */
@@ -7,121 +7,99 @@
 /*                                                              */
 /*                                                              */
 /*  SYNOPSIS                                                    */
-/*  create_random_distrb( struct world_object *world)			*/
+/*  double random_uniform(unsigned long seed, long ID,		*/
+/*		long day, int draw)					*/
+/*  double normdist(double mean, double std,			*/
+/*		unsigned long seed, long ID, long day, int draw)	*/
+/*  double unifdist(double min, double max,			*/
+/*		unsigned long seed, long ID, long day, int draw)	*/
 /*                                                              */
 /*  OPTIONS                                                     */
 /*                                                              */
 /*  DESCRIPTION                                                 */
 /*                                                              */
-/*                                                              */
+/*  Counter-based random numbers: each deviate is a hash of	*/
+/*  the run seed (-seed), the ID of the object drawing it,	*/
+/*  the julian day and a draw number, with no state kept	*/
+/*  between calls.  The same key always gives the same		*/
+/*  deviate, so a run is reproduced by its seed whatever the	*/
+/*  order objects are simulated in, and draws for different	*/
+/*  objects or days are independent.  Callers pick distinct	*/
+/*  draw numbers for the deviates one object needs in a day.	*/
+/*  Each distribution also puts its own stream tag in the	*/
+/*  key, so normdist and unifdist never share a deviate even	*/
+/*  when called with the same draw number.			*/
 /*                                                              */
 /*  PROGRAMMER NOTES                                            */
 /*                                                              */
-/*                                                              */
-/* gasdev taken from Numerical Recipes in C			*/
-/* World Wide Web sample page from NUMERICAL RECIPES IN C: THE ART OF SCIENTIFIC COMPUTING (ISBN 0-521-43108-5) */
+/*  The key is mixed with the splitmix64 finaliser (Steele,	*/
+/*  Lea and Flood 2014), applied once per key word.  normdist	*/
+/*  uses the Box-Muller transform of two uniform deviates	*/
+/*  (draws 2*draw and 2*draw+1 of its stream).			*/
 /*                                                              */
 /*--------------------------------------------------------------*/
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <math.h>
-#include "rhessys.h" 
-#include <time.h> 
-/*--------------------------------------------------------------*/
-/* "Minimal random number generator of Park and Miller with Bays-Durham shuffle and added safeguards.  
-/* Returns a uniform random deviate between 0.0 and 1.0 (exclusive of the endpoint values).
-/* Call with idum a negative integer to initialize; thereafter, do not alther idum between succesive deviates in a sequence
-/* RNMX should approximate the largest floating value that is less than 1. */
-/*--------------------------------------------------------------*/
+#include "rhessys.h"
 
-#define IA 16807
-#define IM 2147483647
-#define AM (1.0/IM)
-#define IQ 127773
-#define IR 2836
-#define NTAB 32
-#define EDIV (1+(IM-1)/NTAB)
-#define EPS 1.2e-7
-#define RNMX (1.0-EPS)
-
-float ran1(long *idum)
+#define RANDOM_GOLDEN	0x9E3779B97F4A7C15ULL
+#define RANDOM_STREAM_UNIFORM	1
+#define RANDOM_STREAM_NORMAL	2
 
+static uint64_t random_mix(uint64_t x)
 {
-	int j;
-	long k;
-	static long iy=0;
-	static long iv[NTAB];
-	float temp;
-	
-	if (*idum <= 0 || !iy) {         /*Initialize*/
-		if (-(*idum) < 1) *idum=1; /*Be sure to prevent idum=0*/
-		else *idum = -(*idum);
-		for (j=NTAB+7; j>=0; j--) { /*Load the shuffle table (after 8 warm-ups)*/
-			k=(*idum)/IQ;
-			*idum=IA*(*idum-k*IQ)-IR*k;
-			if (*idum < 0) *idum += IM;
-			if (j < NTAB) iv[j] = *idum;
-		}
-		iy=iv[0];
-	}
-	k=(*idum)/IQ;		/*Start here when not initializing*/
-	*idum=IA*(*idum-k*IQ)-IR*k;	/*Compute idum=(IS*idum) % IM without overflows by Schrage's method*/
-	if (*idum < 0) *idum += IM;
-	j=iy/EDIV;				/*Will be in the range 0..NTAB-1*/
-	iy=iv[j];				/*Output previously stored value and refill the shuffle table*/
-	iv[j] = *idum;
-
-	temp = AM*iy;
-	if ((temp=AM*iy) > RNMX) return RNMX;	
-	else return temp;
+	x += RANDOM_GOLDEN;
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+	return(x ^ (x >> 31));
 }
 
-#include <math.h>
-/*--------------------------------------------------------------*/
-/*Returns a normally distributed deviate with zero mean and unit variance, using ran1(idum) as the source of uniform deviates*/
-/*--------------------------------------------------------------*/
+static double random_stream(unsigned long seed, long ID, long day,
+							int stream, int draw)
+{
+	/*------------------------------------------------------*/
+	/*	Local Variable Definition. 							*/
+	/*------------------------------------------------------*/
+	uint64_t	x;
+
+	x = random_mix((uint64_t) seed);
+	x = random_mix(x ^ (uint64_t) ID);
+	x = random_mix(x ^ (uint64_t) day);
+	x = random_mix(x ^ (uint64_t) stream);
+	x = random_mix(x ^ (uint64_t) draw);
+	/*------------------------------------------------------*/
+	/*	top 53 bits, centred in their interval: in (0,1)	*/
+	/*------------------------------------------------------*/
+	return( ((double) (x >> 11) + 0.5) / 9007199254740992.0 );
+}
 
-float gasdev ()
+double random_uniform(unsigned long seed, long ID, long day, int draw)
 {
-	static int iset=0;
-	static float gset;
-	float fac,rsq,v1,v2;
-	
-		if (iset == 0) {
-		do {
- /* We dont have an extra deviate handy, so pick two uniform numbers in the square extending from -1 to +1 in each direction, see if they are in the unit circle*/
-			v1=2.0*rand()/(RAND_MAX+1.0)-1.0; 
-			v2=2.0*rand()/(RAND_MAX+1.0)-1.0;
-			rsq=v1*v1+v2*v2;
-			} while (rsq >= 1.0 || rsq == 0.0);		/*and if they are not, try again*/
-			fac=sqrt(-2.0*log(rsq)/rsq);
-			/*Now make the Box-Muller transformation to get two normal deviates.  Return one and save the other for next time*/
-			gset=v1*fac;
-			iset=1;				/*set flag*/
-			return v2*fac;
-		} else {				/*We have an extra deviate handy, so unset the flag and return it*/
-			iset=0;
-			return gset;
-		}
-	}
-double normdist(double mean, double std)
+	return( random_stream(seed, ID, day, RANDOM_STREAM_UNIFORM, draw) );
+}
+
+double normdist(double mean, double std,
+				unsigned long seed, long ID, long day, int draw)
 {
 	/*------------------------------------------------------*/
 	/*	Local Variable Definition. 							*/
 	/*------------------------------------------------------*/
 
-	double result;
+	double result, u1, u2;
 
-	float gasdev();
+	u1 = random_stream(seed, ID, day, RANDOM_STREAM_NORMAL, 2*draw);
+	u2 = random_stream(seed, ID, day, RANDOM_STREAM_NORMAL, 2*draw+1);
+	result = sqrt(-2.0*log(u1)) * cos(2.0*PI*u2)*std+mean;
 
-	result = gasdev()*std+mean;
-	
 	return(result);
 }
 
 
-double unifdist(double min, double max)
+double unifdist(double min, double max,
+				unsigned long seed, long ID, long day, int draw)
 {
 	/*------------------------------------------------------*/
 	/*	Local Variable Definition. 							*/
@@ -129,12 +107,10 @@ double unifdist(double min, double max)
 
 	double result, range;
 
-
-    int random_integer = rand(); 
 		range = max-min;
 
 	if (range > 0)
-		result = random_integer/(RAND_MAX+1.0)*range+min;
+		result = random_uniform(seed, ID, day, draw)*range+min;
 	else
 		result = 0;
 
@@ -0,0 +1,57 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					find_redefine_entry							*/
+/*																*/
+/*	find_redefine_entry - looks up an object by ID in the		*/
+/*			sparse redefine index								*/
+/*																*/
+/*	NAME														*/
+/*	find_redefine_entry - looks up an object by ID in the		*/
+/*			sparse redefine index								*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	struct redefine_index_entry *find_redefine_entry(			*/
+/*					struct	redefine_index_object	*index,		*/
+/*					int	level,									*/
+/*					int	ID)										*/
+/*																*/
+/*	OPTIONS														*/
+/*	level - SCHEMA_ZONE, SCHEMA_PATCH or SCHEMA_STRATUM			*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Binary search of the sorted table built by					*/
+/*	construct_redefine_index.  Returns NULL if no object at		*/
+/*	that level has the ID.										*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include "rhessys.h"
+
+struct redefine_index_entry *find_redefine_entry(
+							struct redefine_index_object *index,
+							int level,
+							int ID)
+{
+	/*------------------------------------------------------*/
+	/*	Local Variable Definition. 							*/
+	/*------------------------------------------------------*/
+	int	low, high, mid;
+	struct	redefine_index_entry	*entries;
+
+	entries = index[0].entries[level];
+	low = 0;
+	high = index[0].num_entries[level] - 1;
+	while (low <= high){
+		mid = low + (high - low) / 2;
+		if (entries[mid].ID < ID)
+			low = mid + 1;
+		else if (entries[mid].ID > ID)
+			high = mid - 1;
+		else
+			return(&(entries[mid]));
+	}
+	return(NULL);
+} /*end find_redefine_entry*/
@@ -0,0 +1,40 @@
+/*--------------------------------------------------------------*/
+/*                                                              */
+/*		find_schema_entry				*/
+/*                                                              */
+/*  NAME                                                        */
+/*		find_schema_entry				*/
+/*                                                              */
+/*                                                              */
+/*  SYNOPSIS                                                    */
+/*  struct output_schema_entry *find_schema_entry(		*/
+/*			struct command_line_object *command_line,	*/
+/*			int level, int step)			*/
+/*                                                              */
+/*  OPTIONS                                                     */
+/*                                                              */
+/*  DESCRIPTION                                                 */
+/*                                                              */
+/*	returns the output schema entry for a level and time	*/
+/*	step, or NULL if no -outschema was given or it lists	*/
+/*	no variables for that level and time step, in which	*/
+/*	case the fixed format output is used			*/
+/*                                                              */
+/*  PROGRAMMER NOTES                                            */
+/*                                                              */
+/*                                                              */
+/*--------------------------------------------------------------*/
+
+#include <stdio.h>
+#include "rhessys.h"
+
+struct output_schema_entry *find_schema_entry(
+					struct command_line_object *command_line,
+					int level, int step)
+{
+	if (command_line[0].output_schema == NULL)
+		return(NULL);
+	if (command_line[0].output_schema[0].entry[level][step].num_vars == 0)
+		return(NULL);
+	return(&(command_line[0].output_schema[0].entry[level][step]));
+} /*end find_schema_entry*/
@@ -0,0 +1,91 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*						profile_timer							*/
+/*																*/
+/*	profile_timer - starts and stops -profile region timers		*/
+/*																*/
+/*	NAME														*/
+/*	profile_timer - starts and stops -profile region timers		*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	double	profile_clock( void )								*/
+/*	void	profile_start( struct profile_object *profile,		*/
+/*				int	region)										*/
+/*	void	profile_stop( struct profile_object *profile,		*/
+/*				int	region)										*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	profile_clock returns monotonic wall-clock seconds.			*/
+/*	profile_start pushes a PROFILE_* region on the profile		*/
+/*	stack and profile_stop pops it, adding the elapsed time to	*/
+/*	the region's inclusive time, the elapsed time less that		*/
+/*	of its children to its exclusive time, and the elapsed		*/
+/*	time to its parent's child time.  The parent of a region	*/
+/*	is the region running when it is first started.				*/
+/*																*/
+/*	Both do nothing when profile is NULL (no -profile), so		*/
+/*	calls can be left in place at a cost of one test.			*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*	Starts and stops must pair up; a stop for a region that		*/
+/*	is not on top of the stack is a fatal error.				*/
+/*																*/
+/*--------------------------------------------------------------*/
+#define _POSIX_C_SOURCE 200112L
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "rhessys.h"
+
+double	profile_clock( void )
+{
+	struct	timespec	now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return( (double) now.tv_sec + 1.0e-9 * (double) now.tv_nsec );
+}
+
+void	profile_start( struct profile_object *profile, int region )
+{
+	if (profile == NULL)
+		return;
+	if (profile[0].depth == PROFILE_MAX_DEPTH){
+		fprintf(stderr,"FATAL ERROR: profile regions nested too deeply\n");
+		exit(EXIT_FAILURE);
+	}
+	if (profile[0].calls[region] == 0)
+		profile[0].parent[region] = (profile[0].depth > 0) ?
+			profile[0].stack[profile[0].depth-1] : -1;
+	profile[0].calls[region] += 1;
+	profile[0].stack[profile[0].depth] = region;
+	profile[0].child_time[profile[0].depth] = 0.0;
+	profile[0].started[profile[0].depth] = profile_clock();
+	profile[0].depth += 1;
+	return;
+}
+
+void	profile_stop( struct profile_object *profile, int region )
+{
+	int	d;
+	double	elapsed;
+
+	if (profile == NULL)
+		return;
+	d = profile[0].depth - 1;
+	if ( (d < 0) || (profile[0].stack[d] != region) ){
+		fprintf(stderr,"FATAL ERROR: profile region %d stopped out of order\n",
+			region);
+		exit(EXIT_FAILURE);
+	}
+	elapsed = profile_clock() - profile[0].started[d];
+	profile[0].inclusive[region] += elapsed;
+	profile[0].exclusive[region] += elapsed - profile[0].child_time[d];
+	if (d > 0)
+		profile[0].child_time[d-1] += elapsed;
+	profile[0].depth = d;
+	return;
+}
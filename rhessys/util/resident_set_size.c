@@ -0,0 +1,55 @@
+/*--------------------------------------------------------------*/
+/* 																*/
+/*					resident_set_size							*/
+/*																*/
+/*	resident_set_size - memory held by the process				*/
+/*																*/
+/*	NAME														*/
+/*	resident_set_size - memory held by the process				*/
+/*																*/
+/*	SYNOPSIS													*/
+/*	void resident_set_size(										*/
+/*			double	*current,									*/
+/*			double	*peak)										*/
+/*																*/
+/*	OPTIONS														*/
+/*																*/
+/*	DESCRIPTION													*/
+/*																*/
+/*	Returns the current and peak resident set size of the		*/
+/*	process in MB.  Either is -1 where the system does not		*/
+/*	report it (the current size is read from /proc).			*/
+/*																*/
+/*	PROGRAMMER NOTES											*/
+/*																*/
+/*	ru_maxrss is in kB on Linux but in bytes on Mac OS X.		*/
+/*																*/
+/*--------------------------------------------------------------*/
+#define _XOPEN_SOURCE 600
+#include <stdio.h>
+#include <unistd.h>
+#include <sys/resource.h>
+
+void	resident_set_size(
+						  double	*current,
+						  double	*peak)
+{
+	long	pages;
+	struct	rusage	usage;
+	FILE	*statm;
+
+	*current = -1.0;
+	if ( (statm = fopen("/proc/self/statm", "r")) != NULL ){
+		if (fscanf(statm, "%*s %ld", &pages) == 1)
+			*current = (double) pages * sysconf(_SC_PAGESIZE) / 1048576.0;
+		fclose(statm);
+	}
+	*peak = -1.0;
+	if (getrusage(RUSAGE_SELF, &usage) == 0)
+#ifdef __APPLE__
+		*peak = usage.ru_maxrss / 1048576.0;
+#else
+		*peak = usage.ru_maxrss / 1024.0;
+#endif
+	return;
+} /*end resident_set_size*/
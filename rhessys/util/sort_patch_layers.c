@@ -32,6 +32,7 @@ void sort_patch_layers( struct patch_object *patch)
 	/*--------------------------------------------------------------*/
 	int key_compare(void *,  void *);
 	void	*alloc( 	size_t, char *, char *);
+	void	dealloc( void *, size_t, char *, char * );
 	/*--------------------------------------------------------------*/
 	/*  Local variable definition.                                  */
 	/*--------------------------------------------------------------*/
@@ -42,7 +43,10 @@ void sort_patch_layers( struct patch_object *patch)
 	/*	free current layer structure				*/
 	/*--------------------------------------------------------------*/
 	for ( i=0 ; i<patch[0].num_layers ; i++ ) {
-		free(patch[0].layers[i].strata);
+		dealloc(patch[0].layers[i].strata,
+			patch[0].layers[i].count*sizeof(long),
+			"patch[0].layers[i].strata",
+			"construct_patch");
 		patch[0].layers[i].count = 0;
 	}
 	/*--------------------------------------------------------------*/
@@ -0,0 +1,98 @@
+#!/bin/bash
+# This shell script runs the standard RHESSys benchmark configurations
+# on a world written by synthworld and records their throughput
+
+rhessys=../../rhessys/rhessys5.18.r2
+benchdir=bench
+hillslopes=4
+patches=100
+strata=1
+years=2
+
+USAGE="Usage: `basename $0` [-r rhessys] [-d dir] [-n hillslopes] [-p patches] [-s strata] [-y years]"
+
+# Parse command line options.
+while getopts r:d:n:p:s:y:h OPT; do
+    case "$OPT" in
+        r)
+            rhessys=$OPTARG
+            ;;
+        d)
+            benchdir=$OPTARG
+            ;;
+        n)
+            hillslopes=$OPTARG
+            ;;
+        p)
+            patches=$OPTARG
+            ;;
+        s)
+            strata=$OPTARG
+            ;;
+        y)
+            years=$OPTARG
+            ;;
+        h)
+            echo $USAGE
+            exit 0
+            ;;
+        \?)
+            # getopts issues an error message
+            echo $USAGE >&2
+            exit 1
+            ;;
+    esac
+done
+
+if [ ! -x "$rhessys" ]; then
+    echo "`basename $0`: $rhessys not found, build rhessys first" >&2
+    exit 1
+fi
+rhessys=`cd \`dirname $rhessys\` && pwd`/`basename $rhessys`
+version=`$rhessys -version 2>/dev/null | sed -n 's/^RHESSys Version: //p'`
+synthworld=`pwd`/synthworld
+
+mkdir -p $benchdir
+cd $benchdir
+world=world_${hillslopes}x${patches}x${strata}
+$synthworld -o $world -h $hillslopes -p $patches -s $strata -y $years > /dev/null || exit 1
+cd $world
+
+st="2000 1 1 1"
+ed="$((2000 + years)) 1 1 1"
+days=`awk -v y=$years 'BEGIN { d = 0; for (i = 2000; i < 2000 + y; i++) d += ((i % 4 == 0 && i % 100 != 0) || i % 400 == 0) ? 366 : 365; print d }'`
+patch_days=$((hillslopes * patches * days))
+
+if [ ! -f ../bench.csv ]; then
+    echo "date,version,world,config,seconds,patch_days,patch_days_per_s" > ../bench.csv
+fi
+
+# name|tec file|options
+configs="
+no_routing|quiet|
+no_routing_daily|synth|-b -h -z -p -c
+routing|quiet|-r flows/synth.flow
+routing_daily|synth|-r flows/synth.flow -b -h -z -p -c
+routing_growth|quiet|-r flows/synth.flow -g
+routing_growth_daily|synth|-r flows/synth.flow -g -b -h -z -p -c
+"
+
+printf "%-24s %10s %14s\n" config seconds patch-days/s
+echo "$configs" | while IFS='|' read name tec options; do
+    [ -z "$name" ] && continue
+    start=`date +%s.%N`
+    $rhessys -t tecfiles/$tec.tec -w worlds/synth.world -st $st -ed $ed \
+        $options -pre out_$name > out_$name.log 2>&1
+    status=$?
+    end=`date +%s.%N`
+    if [ $status -ne 0 ]; then
+        echo "`basename $0`: $name failed, see $benchdir/$world/out_$name.log" >&2
+        exit 1
+    fi
+    awk -v s=$start -v e=$end -v n=$name -v pd=$patch_days \
+        -v d="`date +%Y-%m-%d`" -v v="$version" -v w=$world 'BEGIN {
+        t = e - s
+        printf "%-24s %10.3f %14.0f\n", n, t, pd / t > "/dev/stderr"
+        printf "%s,%s,%s,%s,%.3f,%d,%.0f\n", d, v, w, n, t, pd, pd / t
+    }' >> ../bench.csv
+done 2>&1
@@ -0,0 +1,572 @@
+/*--------------------------------------------------------------*/
+/*								*/
+/*		synthworld					*/
+/*								*/
+/*	synthworld.c - writes a self-consistent synthetic	*/
+/*		RHESSys world for benchmarking			*/
+/*								*/
+/*	NAME							*/
+/*	synthworld						*/
+/*								*/
+/*	SYNOPSIS						*/
+/*	synthworld [-o dir] [-b basins] [-h hillslopes]		*/
+/*		[-p patches] [-s strata] [-y years] [-start year]	*/
+/*		[-seed n]						*/
+/*								*/
+/*	OPTIONS							*/
+/*	-o	output directory (default ./synth)		*/
+/*	-b	number of basins (default 1)			*/
+/*	-h	hillslopes per basin (default 2)			*/
+/*	-p	patches per hillslope (default 16)		*/
+/*	-s	canopy strata per patch (default 1)		*/
+/*	-y	years of daily climate (default 2)		*/
+/*	-start	first climate year (default 2000)		*/
+/*	-seed	seed for the synthetic climate (default 1)	*/
+/*								*/
+/*	DESCRIPTION						*/
+/*								*/
+/*	Writes, under the output directory:			*/
+/*		worlds/synth.world	 worldfile		*/
+/*		worlds/synth.world.hdr	 worldfile header	*/
+/*		flows/synth.flow	 routing table		*/
+/*		defs/<level>.def	 default files		*/
+/*		clim/synth.base		 base station		*/
+/*		clim/synth.{tmax,tmin,rain}  daily climate	*/
+/*		tecfiles/synth.tec	 tec file, daily output	*/
+/*		tecfiles/quiet.tec	 tec file, no output	*/
+/*								*/
+/*	Each hillslope is a square grid of one-patch zones.	*/
+/*	The bottom row of every hillslope is stream; every	*/
+/*	other patch drains to the three patches below it.	*/
+/*	The routing table covers the first basin only, since	*/
+/*	rhessys reads the same table for every basin.		*/
+/*								*/
+/*	The climate is a deterministic seasonal cycle with	*/
+/*	pseudo random storms so that runs are reproducible.	*/
+/*								*/
+/*	PROGRAMMER NOTES					*/
+/*								*/
+/*	Default files follow the RHESSys V5 standard values.	*/
+/*--------------------------------------------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#define FILEPATH_LEN 1024
+#define STREAM 1
+#define LAND 0
+#define PI 3.14159265358979
+#define CELL 30.0
+
+struct	synth_option
+	{
+	int	num_basins;
+	int	num_hillslopes;
+	int	num_patches;
+	int	num_strata;
+	int	num_years;
+	int	start_year;
+	unsigned long	seed;
+	char	dir[FILEPATH_LEN];
+	};
+
+static	unsigned long	rng_state;
+
+static	double	synth_uniform(void)
+{
+	/*--------------------------------------------------------------*/
+	/*	xorshift64* - portable and identical on every platform	*/
+	/*--------------------------------------------------------------*/
+	unsigned long long x = rng_state;
+	x ^= x >> 12;
+	x ^= x << 25;
+	x ^= x >> 27;
+	rng_state = x;
+	return( (double)((x * 2685821657736338717ULL) >> 11) / 9007199254740992.0 );
+}
+
+static	FILE	*open_output(struct synth_option *opt, char *name)
+{
+	char	filename[FILEPATH_LEN];
+	FILE	*out;
+
+	if (snprintf(filename, FILEPATH_LEN, "%s/%s", opt->dir, name)
+		>= FILEPATH_LEN) {
+		fprintf(stderr, "FATAL ERROR: path %s/%s too long\n", opt->dir, name);
+		exit(EXIT_FAILURE);
+	}
+	if ( (out = fopen(filename, "w")) == NULL ) {
+		fprintf(stderr, "FATAL ERROR: cannot open %s for writing\n", filename);
+		exit(EXIT_FAILURE);
+	}
+	return(out);
+}
+
+static	void	make_dir(struct synth_option *opt, char *name)
+{
+	char	dirname[FILEPATH_LEN];
+
+	if (name == NULL)
+		strcpy(dirname, opt->dir);
+	else if (snprintf(dirname, FILEPATH_LEN, "%s/%s", opt->dir, name)
+		>= FILEPATH_LEN) {
+		fprintf(stderr, "FATAL ERROR: path %s/%s too long\n", opt->dir, name);
+		exit(EXIT_FAILURE);
+	}
+	mkdir(dirname, 0755);
+}
+
+static	int	grid_width(int num_patches)
+{
+	int	w;
+
+	w = (int) ceil(sqrt((double) num_patches));
+	if (w < 1) w = 1;
+	return(w);
+}
+
+/*--------------------------------------------------------------*/
+/*	patch IDs are unique within a basin: hill*10000+p+1	*/
+/*--------------------------------------------------------------*/
+static	int	patch_id(int h, int p)
+{
+	return( (h+1)*10000 + p + 1 );
+}
+
+static	double	patch_z(struct synth_option *opt, int h, int p)
+{
+	int	w;
+
+	w = grid_width(opt->num_patches);
+	return( 1000.0 + 15.0 * (p / w) + 2.0 * h );
+}
+
+static	void	write_defaults(struct synth_option *opt)
+{
+	FILE	*f;
+
+	f = open_output(opt, "defs/basin.def");
+	fprintf(f, "1\tbasin_default_ID\n");
+	fprintf(f, "24\tn_routing_timesteps\n");
+	fclose(f);
+
+	f = open_output(opt, "defs/hill.def");
+	fprintf(f, "1\thillslope_default_ID\n");
+	fprintf(f, "0.2\tgw_loss_coeff\n");
+	fclose(f);
+
+	f = open_output(opt, "defs/zone.def");
+	fprintf(f, "1\tzone_default_ID\n");
+	fprintf(f, "0.000029\tatm_trans_lapse_rate\n");
+	fprintf(f, "0.0015\tdewpoint_lapse_rate\n");
+	fprintf(f, "10\tmax_effective_lai\n");
+	fprintf(f, "0.0064\tlapse_rate\n");
+	fprintf(f, "0.0254\tpptmin\n");
+	fprintf(f, "0.75\tsea_level_clear_sky_trans\n");
+	fprintf(f, "0.4\ttemcf\n");
+	fprintf(f, "0.003\ttrans_coeff1\n");
+	fprintf(f, "2.2\ttrans_coeff2\n");
+	fprintf(f, "1\twind\n");
+	fprintf(f, "-6\tmax_snow_temp\n");
+	fprintf(f, "-8\tmin_rain_temp\n");
+	fprintf(f, "0.001\tn_deposition\n");
+	fclose(f);
+
+	f = open_output(opt, "defs/soil.def");
+	fprintf(f, "1\tpatch_default_ID\n");
+	fprintf(f, "1\ttheta_psi_curve\n");
+	fprintf(f, "0.6\tKsat_0\n");
+	fprintf(f, "0.12\tm\n");
+	fprintf(f, "0.451\tporosity_0\n");
+	fprintf(f, "4000\tporosity_decay\n");
+	fprintf(f, "0.186\tpore_size_index\n");
+	fprintf(f, "0.478\tpsi_air_entry\n");
+	fprintf(f, "0.01\tpsi_max\n");
+	fprintf(f, "2.0\tsoil_depth\n");
+	fprintf(f, "0.24\tm_z\n");
+	fprintf(f, "1.0\tactive_zone_z\n");
+	fprintf(f, "0.26\talbedo\n");
+	fprintf(f, "0.4\tsand\n");
+	fprintf(f, "0.4\tsilt\n");
+	fprintf(f, "0.2\tclay\n");
+	fprintf(f, "0.1\tsat_to_gw_coeff\n");
+	fclose(f);
+
+	f = open_output(opt, "defs/landuse.def");
+	fprintf(f, "1\tlanduse_default_ID\n");
+	fclose(f);
+
+	f = open_output(opt, "defs/veg.def");
+	fprintf(f, "1\tstratum_default_ID\n");
+	fprintf(f, "TREE\tepc.veg.type\n");
+	fprintf(f, "0.54\tepc.ext_coef\n");
+	fprintf(f, "dynamic\tepc.phenology_flag\n");
+	fprintf(f, "DECID\tepc.phenology.type\n");
+	fprintf(f, "5.0\tepc.max_lai\n");
+	fprintf(f, "31.3\tepc.proj_sla\n");
+	fprintf(f, "90\tepc.day_leafon\n");
+	fprintf(f, "285\tepc.day_leafoff\n");
+	fprintf(f, "30\tepc.ndays_expand\n");
+	fprintf(f, "30\tepc.ndays_litfall\n");
+	fprintf(f, "constant\tepc.allocation_flag\n");
+	fclose(f);
+}
+
+static	void	write_climate(struct synth_option *opt)
+{
+	FILE	*base, *ftmax, *ftmin, *frain;
+	int	d, num_days, doy;
+	double	tavg, range, rain;
+
+	base = open_output(opt, "clim/synth.base");
+	fprintf(base, "101\tbase_station_id\n");
+	fprintf(base, "0.0\tx_coordinate\n");
+	fprintf(base, "0.0\ty_coordinate\n");
+	fprintf(base, "1000.0\tz_coordinate\n");
+	fprintf(base, "3.5\teffective_lai\n");
+	fprintf(base, "2\tscreen_height\n");
+	fprintf(base, "clim/synth\tannual_climate_prefix\n");
+	fprintf(base, "0\tnumber_non_critical_annual_sequences\n");
+	fprintf(base, "clim/synth\tmonthly_climate_prefix\n");
+	fprintf(base, "0\tnumber_non_critical_monthly_sequences\n");
+	fprintf(base, "clim/synth\tdaily_climate_prefix\n");
+	fprintf(base, "0\tnumber_non_critical_daily_sequences\n");
+	fprintf(base, "clim/synth\thourly_climate_prefix\n");
+	fprintf(base, "0\tnumber_non_critical_hourly_sequences\n");
+	fclose(base);
+
+	ftmax = open_output(opt, "clim/synth.tmax");
+	ftmin = open_output(opt, "clim/synth.tmin");
+	frain = open_output(opt, "clim/synth.rain");
+	fprintf(ftmax, "%d 1 1 1\n", opt->start_year);
+	fprintf(ftmin, "%d 1 1 1\n", opt->start_year);
+	fprintf(frain, "%d 1 1 1\n", opt->start_year);
+
+	/*--------------------------------------------------------------*/
+	/*	one extra year of record so any end date inside the	*/
+	/*	requested range is covered				*/
+	/*--------------------------------------------------------------*/
+	num_days = (opt->num_years + 1) * 366;
+	rng_state = opt->seed * 0x9E3779B97F4A7C15ULL + 1;
+	for (d = 0; d < num_days; d++) {
+		doy = d % 365;
+		tavg = 8.0 - 10.0 * cos(2.0 * PI * (doy + 10) / 365.0);
+		range = 10.0 + 3.0 * (synth_uniform() - 0.5);
+		rain = 0.0;
+		/*--------------------------------------------------------------*/
+		/*	wet winters, dry summers				*/
+		/*--------------------------------------------------------------*/
+		if (synth_uniform() < 0.35 + 0.25 * cos(2.0 * PI * doy / 365.0))
+			rain = -0.008 * log(1.0 - synth_uniform());
+		fprintf(ftmax, "%.2f\n", tavg + range / 2.0);
+		fprintf(ftmin, "%.2f\n", tavg - range / 2.0);
+		fprintf(frain, "%.5f\n", rain);
+	}
+	fclose(ftmax);
+	fclose(ftmin);
+	fclose(frain);
+}
+
+static	void	write_header(struct synth_option *opt)
+{
+	FILE	*f;
+
+	f = open_output(opt, "worlds/synth.world.hdr");
+	fprintf(f, "1\tnum_basin_files\n");
+	fprintf(f, "defs/basin.def\tbasin_default_file\n");
+	fprintf(f, "1\tnum_hillslope_files\n");
+	fprintf(f, "defs/hill.def\thillslope_default_file\n");
+	fprintf(f, "1\tnum_zone_files\n");
+	fprintf(f, "defs/zone.def\tzone_default_file\n");
+	fprintf(f, "1\tnum_soil_files\n");
+	fprintf(f, "defs/soil.def\tsoil_default_file\n");
+	fprintf(f, "1\tnum_landuse_files\n");
+	fprintf(f, "defs/landuse.def\tlanduse_default_file\n");
+	fprintf(f, "1\tnum_stratum_files\n");
+	fprintf(f, "defs/veg.def\tstratum_default_file\n");
+	fprintf(f, "1\tnum_base_stations\n");
+	fprintf(f, "clim/synth.base\tbase_station_file\n");
+	fclose(f);
+}
+
+#define	WI(f, v, n)	fprintf(f, "%-30d %s\n", (v), (n))
+#define	WD(f, v, n)	fprintf(f, "%-30.8f %s\n", (v), (n))
+
+static	void	write_stratum(FILE *f, int ID, double cover)
+{
+	WI(f, ID, "canopy_strata_ID");
+	WI(f, 1, "veg_parm_ID");
+	WD(f, cover, "cover_fraction");
+	WD(f, 0.0, "gap_fraction");
+	WD(f, 0.5, "rootzone.depth");
+	WD(f, 0.0, "snow_stored");
+	WD(f, 0.0, "rain_stored");
+	WD(f, 0.0, "cs.cpool");
+	WD(f, 0.2, "cs.leafc");
+	WD(f, 0.0, "cs.dead_leafc");
+	WD(f, 0.0, "cs.leafc_store");
+	WD(f, 0.0, "cs.leafc_transfer");
+	WD(f, 0.1, "cs.live_stemc");
+	WD(f, 0.0, "cs.livestemc_store");
+	WD(f, 0.0, "cs.livestemc_transfer");
+	WD(f, 2.0, "cs.dead_stemc");
+	WD(f, 0.0, "cs.deadstemc_store");
+	WD(f, 0.0, "cs.deadstemc_transfer");
+	WD(f, 0.05, "cs.live_crootc");
+	WD(f, 0.0, "cs.livecrootc_store");
+	WD(f, 0.0, "cs.livecrootc_transfer");
+	WD(f, 0.5, "cs.dead_crootc");
+	WD(f, 0.0, "cs.deadcrootc_store");
+	WD(f, 0.0, "cs.deadcrootc_transfer");
+	WD(f, 0.2, "cs.frootc");
+	WD(f, 0.0, "cs.frootc_store");
+	WD(f, 0.0, "cs.frootc_transfer");
+	WD(f, 0.0, "cs.cwdc");
+	WD(f, 0.0, "epv.prev_leafcalloc");
+	WD(f, 0.0, "ns.npool");
+	WD(f, 0.008, "ns.leafn");
+	WD(f, 0.0, "ns.dead_leafn");
+	WD(f, 0.0, "ns.leafn_store");
+	WD(f, 0.0, "ns.leafn_transfer");
+	WD(f, 0.002, "ns.live_stemn");
+	WD(f, 0.0, "ns.livestemn_store");
+	WD(f, 0.0, "ns.livestemn_transfer");
+	WD(f, 0.004, "ns.dead_stemn");
+	WD(f, 0.0, "ns.deadstemn_store");
+	WD(f, 0.0, "ns.deadstemn_transfer");
+	WD(f, 0.001, "ns.live_crootn");
+	WD(f, 0.0, "ns.livecrootn_store");
+	WD(f, 0.0, "ns.livecrootn_transfer");
+	WD(f, 0.001, "ns.dead_crootn");
+	WD(f, 0.0, "ns.deadcrootn_store");
+	WD(f, 0.0, "ns.deadcrootn_transfer");
+	WD(f, 0.004, "ns.frootn");
+	WD(f, 0.0, "ns.frootn_store");
+	WD(f, 0.0, "ns.frootn_transfer");
+	WD(f, 0.0, "ns.cwdn");
+	WD(f, 0.0, "ns.retransn");
+	WI(f, 0, "epv.wstress_days");
+	WD(f, 0.0, "epv.max_fparabs");
+	WD(f, 0.0, "epv.min_vwc");
+	WI(f, 0, "n_basestations");
+}
+
+static	void	write_world(struct synth_option *opt)
+{
+	FILE	*f;
+	int	b, h, p, s, w;
+	double	z;
+
+	f = open_output(opt, "worlds/synth.world");
+	w = grid_width(opt->num_patches);
+	WI(f, 1, "world_id");
+	WI(f, opt->num_basins, "num_basins");
+	for (b = 0; b < opt->num_basins; b++) {
+		WI(f, b+1, "basin_ID");
+		WD(f, 0.0, "x");
+		WD(f, 0.0, "y");
+		WD(f, 1000.0, "z");
+		WI(f, 1, "basin_parm_ID");
+		WD(f, 44.0, "latitude");
+		WI(f, 0, "n_basestations");
+		WI(f, opt->num_hillslopes, "num_hillslopes");
+		for (h = 0; h < opt->num_hillslopes; h++) {
+			WI(f, h+1, "hillslope_ID");
+			WD(f, 0.0, "x");
+			WD(f, 0.0, "y");
+			WD(f, 1000.0, "z");
+			WI(f, 1, "hill_parm_ID");
+			WD(f, 0.0, "gw.storage");
+			WD(f, 0.0, "gw.NO3");
+			WI(f, 0, "n_basestations");
+			WI(f, opt->num_patches, "num_zones");
+			for (p = 0; p < opt->num_patches; p++) {
+				z = patch_z(opt, h, p);
+				WI(f, patch_id(h, p), "zone_ID");
+				WD(f, CELL * (p % w), "x");
+				WD(f, CELL * (p / w), "y");
+				WD(f, z, "z");
+				WI(f, 1, "zone_parm_ID");
+				WD(f, CELL * CELL, "area");
+				WD(f, 25.0, "slope");
+				WD(f, 180.0, "aspect");
+				WD(f, 1.0, "precip_lapse_rate");
+				WD(f, 0.1, "e_horizon");
+				WD(f, 0.1, "w_horizon");
+				WI(f, 1, "n_basestations");
+				WI(f, 101, "base_station_ID");
+				WI(f, 1, "num_patches");
+				WI(f, patch_id(h, p), "patch_ID");
+				WD(f, CELL * (p % w), "x");
+				WD(f, CELL * (p / w), "y");
+				WD(f, z, "z");
+				WI(f, 1, "soil_parm_ID");
+				WI(f, 1, "landuse_parm_ID");
+				WD(f, CELL * CELL, "area");
+				WD(f, 25.0, "slope");
+				WD(f, 7.0 - 0.1 * (p / w), "lna");
+				WD(f, 1.0, "Ksat_vertical");
+				WD(f, 0.12, "mpar");
+				WD(f, 0.0, "rz_storage");
+				WD(f, 0.0, "unsat_storage");
+				WD(f, 0.3, "sat_deficit");
+				WD(f, 0.0, "snowpack.water_equivalent_depth");
+				WD(f, 0.0, "snowpack.water_depth");
+				WD(f, -10.0, "snowpack.T");
+				WD(f, 0.0, "snowpack.surface_age");
+				WD(f, -0.5, "snowpack.energy_deficit");
+				WD(f, 1.0, "litter.cover_fraction");
+				WD(f, 0.0, "litter.rain_stored");
+				WD(f, 0.1, "litter_cs.litr1c");
+				WD(f, 0.004, "litter_ns.litr1n");
+				WD(f, 0.1, "litter_cs.litr2c");
+				WD(f, 0.1, "litter_cs.litr3c");
+				WD(f, 0.1, "litter_cs.litr4c");
+				WD(f, 0.2, "soil_cs.soil1c");
+				WD(f, 0.001, "soil_ns.sminn");
+				WD(f, 0.001, "soil_ns.nitrate");
+				WD(f, 1.0, "soil_cs.soil2c");
+				WD(f, 2.0, "soil_cs.soil3c");
+				WD(f, 5.0, "soil_cs.soil4c");
+				WI(f, 0, "n_basestations");
+				WI(f, opt->num_strata, "num_canopy_strata");
+				for (s = 0; s < opt->num_strata; s++)
+					write_stratum(f, patch_id(h, p) * 10 + s + 1,
+						1.0 / opt->num_strata);
+			}
+		}
+	}
+	fclose(f);
+}
+
+static	void	write_flow(struct synth_option *opt)
+{
+	FILE	*f;
+	int	h, p, w, row, col, c, n, num_neighbours;
+	int	neigh[3];
+	double	gamma[3], sum;
+
+	f = open_output(opt, "flows/synth.flow");
+	w = grid_width(opt->num_patches);
+	fprintf(f, "%d\n", opt->num_hillslopes * opt->num_patches);
+	for (h = 0; h < opt->num_hillslopes; h++) {
+		for (p = 0; p < opt->num_patches; p++) {
+			row = p / w;
+			col = p % w;
+			num_neighbours = 0;
+			if (row > 0) {
+				for (c = col-1; c <= col+1; c++) {
+					n = (row-1) * w + c;
+					if ((c < 0) || (c >= w) || (n >= opt->num_patches))
+						continue;
+					neigh[num_neighbours] = n;
+					gamma[num_neighbours] = (c == col) ? 0.5 : 0.25;
+					num_neighbours++;
+				}
+			}
+			sum = 0.0;
+			for (n = 0; n < num_neighbours; n++)
+				sum += gamma[n];
+			fprintf(f, "%8d %8d %8d %10.1f %10.1f %10.1f %12.1f %12.1f %d %12.6f %d\n",
+				patch_id(h, p), patch_id(h, p), h+1,
+				CELL * col, CELL * row, patch_z(opt, h, p),
+				CELL * CELL, CELL * CELL,
+				(row == 0) ? STREAM : LAND,
+				(row == 0) ? 0.0 : CELL * tan(25.0 * PI / 180.0) / CELL,
+				num_neighbours);
+			for (n = 0; n < num_neighbours; n++)
+				fprintf(f, "%16d %8d %8d %12.8f\n",
+					patch_id(h, neigh[n]), patch_id(h, neigh[n]), h+1,
+					gamma[n] / sum);
+		}
+	}
+	fclose(f);
+}
+
+static	void	write_tec(struct synth_option *opt)
+{
+	FILE	*f;
+
+	f = open_output(opt, "tecfiles/synth.tec");
+	fprintf(f, "%d 1 1 1 print_daily_on\n", opt->start_year);
+	fclose(f);
+
+	f = open_output(opt, "tecfiles/quiet.tec");
+	fprintf(f, "%d 1 1 1 print_daily_off\n", opt->start_year);
+	fclose(f);
+}
+
+int	main(int argc, char **argv)
+{
+	struct	synth_option	opt;
+	int	i;
+
+	opt.num_basins = 1;
+	opt.num_hillslopes = 2;
+	opt.num_patches = 16;
+	opt.num_strata = 1;
+	opt.num_years = 2;
+	opt.start_year = 2000;
+	opt.seed = 1;
+	strcpy(opt.dir, "synth");
+
+	for (i = 1; i < argc; i++) {
+		if (i+1 == argc) {
+			fprintf(stderr, "FATAL ERROR: missing value for %s\n", argv[i]);
+			exit(EXIT_FAILURE);
+		}
+		if (strcmp(argv[i], "-o") == 0) {
+			if (strlen(argv[++i]) >= FILEPATH_LEN - 64) {
+				fprintf(stderr, "FATAL ERROR: output directory name too long\n");
+				exit(EXIT_FAILURE);
+			}
+			strcpy(opt.dir, argv[i]);
+		}
+		else if (strcmp(argv[i], "-b") == 0)
+			opt.num_basins = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-h") == 0)
+			opt.num_hillslopes = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-p") == 0)
+			opt.num_patches = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-s") == 0)
+			opt.num_strata = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-y") == 0)
+			opt.num_years = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-start") == 0)
+			opt.start_year = atoi(argv[++i]);
+		else if (strcmp(argv[i], "-seed") == 0)
+			opt.seed = strtoul(argv[++i], NULL, 10);
+		else {
+			fprintf(stderr, "FATAL ERROR: unknown option %s\n", argv[i]);
+			exit(EXIT_FAILURE);
+		}
+	}
+	if ((opt.num_basins < 1) || (opt.num_hillslopes < 1) ||
+		(opt.num_patches < 1) || (opt.num_strata < 1) ||
+		(opt.num_years < 1) || (opt.num_patches > 9999)) {
+		fprintf(stderr, "FATAL ERROR: sizes must be >= 1 (and patches <= 9999)\n");
+		exit(EXIT_FAILURE);
+	}
+
+	make_dir(&opt, NULL);
+	make_dir(&opt, "worlds");
+	make_dir(&opt, "flows");
+	make_dir(&opt, "defs");
+	make_dir(&opt, "clim");
+	make_dir(&opt, "tecfiles");
+
+	write_defaults(&opt);
+	write_climate(&opt);
+	write_header(&opt);
+	write_world(&opt);
+	write_flow(&opt);
+	write_tec(&opt);
+
+	printf("%d basins x %d hillslopes x %d patches x %d strata, %d years in %s\n",
+		opt.num_basins, opt.num_hillslopes, opt.num_patches,
+		opt.num_strata, opt.num_years, opt.dir);
+	return(EXIT_SUCCESS);
+}